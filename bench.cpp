@@ -0,0 +1,1334 @@
+#include <linalg/linalg.hpp>
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <iomanip>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+struct Result {
+    std::string name;
+    double ns;
+    double bytes;
+};
+
+std::vector<Result> results;
+
+// ns is the time of one operation, bytes the memory it reads and writes (0 if not meaningful)
+void record(const std::string& name, double ns, double bytes = 0) {
+    results.push_back({name, ns, bytes});
+}
+
+void writeJson(std::FILE* out) {
+    std::fprintf(out, "{\n  \"simd_width\": %zu,\n  \"threads\": %zu,\n  \"results\": [\n",
+        la::Simd::WIDTH, la::ThreadPool::instance().concurrency());
+
+    for (std::size_t i = 0; i < results.size(); i++) {
+        const Result& r = results[i];
+        std::fprintf(out, "    {\"name\": \"%s\", \"ns_per_op\": %.3f, ", r.name.c_str(), r.ns);
+        if (r.bytes > 0) {
+            std::fprintf(out, "\"gb_per_s\": %.3f}", r.bytes / r.ns);
+        } else {
+            std::fprintf(out, "\"gb_per_s\": null}");
+        }
+        std::fprintf(out, i + 1 < results.size() ? ",\n" : "\n");
+    }
+
+    std::fprintf(out, "  ]\n}\n");
+}
+
+template <typename F>
+double timeNs(F&& f, int iterations) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        f();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+template <typename T>
+void randomize(T& tensor, std::mt19937& rng) {
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    float* p = reinterpret_cast<float*>(&tensor);
+    for (std::size_t i = 0; i < sizeof(T) / sizeof(float); i++) {
+        p[i] = dist(rng);
+    }
+}
+
+template <typename T>
+void doNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+template <int N>
+void benchMatMul(std::mt19937& rng, int iterations) {
+    auto a = std::make_unique<la::Matrix<N, N>>();
+    auto b = std::make_unique<la::Matrix<N, N>>();
+    auto c = std::make_unique<la::Matrix<N, N>>();
+    randomize(*a, rng);
+    randomize(*b, rng);
+
+    const float* pa = &(*a)[0][0];
+    const float* pb = &(*b)[0][0];
+    float* pc = &(*c)[0][0];
+
+    double naive = timeNs([&] {
+        la::Kernels::gemmNaive<N, N, N>(pa, pb, pc);
+        doNotOptimize(*c);
+    }, iterations);
+
+    double blocked = timeNs([&] {
+        la::Kernels::gemm<N, N, N>(pa, pb, pc);
+        doNotOptimize(*c);
+    }, iterations);
+
+    std::string name = "matmul/" + std::to_string(N);
+    record(name + "/naive", naive, 3.0 * N * N * sizeof(float));
+    record(name + "/blocked", blocked, 3.0 * N * N * sizeof(float));
+
+    double flops = 2.0 * N * N * N;
+    std::printf("matmul %4dx%-4d naive %12.1f ns (%6.2f GFLOP/s)  blocked %12.1f ns (%6.2f GFLOP/s)  x%.2f\n",
+        N, N, naive, flops / naive, blocked, flops / blocked, naive / blocked);
+}
+
+template <int N>
+void benchInverse(std::mt19937& rng, int iterations) {
+    la::Matrix<N, N> m;
+    randomize(m, rng);
+    la::Vector<N> b = 1;
+
+    double det = timeNs([&] {
+        float d = m.determinant();
+        doNotOptimize(d);
+    }, iterations);
+
+    double inv = timeNs([&] {
+        la::Matrix<N, N> i = m.inverse();
+        doNotOptimize(i);
+    }, iterations);
+
+    la::LU<N> lu = m.lu();
+    double solve = timeNs([&] {
+        la::Vector<N> x = lu.solve(b);
+        doNotOptimize(x);
+    }, iterations);
+
+    std::string name = "lu/" + std::to_string(N);
+    record(name + "/determinant", det, sizeof(m));
+    record(name + "/inverse", inv, 2 * sizeof(m));
+    record(name + "/solve", solve, sizeof(m) + 2 * sizeof(b));
+
+    std::printf("lu     %4dx%-4d determinant %10.1f ns  inverse %10.1f ns  solve (factored) %10.1f ns\n",
+        N, N, det, inv, solve);
+
+    // the closed-form 2x2 to 4x4 paths against the factorization they replace
+    if constexpr (N <= 4) {
+        double luInv = timeNs([&] {
+            la::Matrix<N, N> i = m.lu().inverse();
+            doNotOptimize(i);
+        }, iterations);
+
+        record(name + "/inverse_lu", luInv, 2 * sizeof(m));
+        std::printf("lu     %4dx%-4d closed-form inverse %10.1f ns  through LU %10.1f ns  x%.1f\n",
+            N, N, inv, luInv, luInv / inv);
+    }
+}
+
+// Matrix routes to the library when built with LINALG_BLAS, against the inline kernels
+template <int N>
+void benchBlas(std::mt19937& rng, int iterations) {
+    auto a = std::make_unique<la::Matrix<N, N>>();
+    auto b = std::make_unique<la::Matrix<N, N>>();
+    auto c = std::make_unique<la::Matrix<N, N>>();
+    randomize(*a, rng);
+    randomize(*b, rng);
+    la::Vector<N> rhs = 1;
+
+    double kernelGemm = timeNs([&] {
+        la::Kernels::gemm<N, N, N>(a->data(), b->data(), c->data());
+        doNotOptimize(*c);
+    }, iterations);
+
+    double blasGemm = timeNs([&] {
+        *c = *a * *b;
+        doNotOptimize(*c);
+    }, iterations);
+
+    double kernelSolve = timeNs([&] {
+        la::Vector<N> x = a->lu().solve(rhs);
+        doNotOptimize(x);
+    }, iterations);
+
+    double blasSolve = timeNs([&] {
+        la::Vector<N> x = a->solve(rhs);
+        doNotOptimize(x);
+    }, iterations);
+
+    double kernelInverse = timeNs([&] {
+        *c = a->lu().inverse();
+        doNotOptimize(*c);
+    }, iterations);
+
+    double blasInverse = timeNs([&] {
+        *c = a->inverse();
+        doNotOptimize(*c);
+    }, iterations);
+
+    std::string name = "blas/" + std::to_string(N);
+    record(name + "/gemm_kernel", kernelGemm, 3.0 * sizeof(*a));
+    record(name + "/gemm", blasGemm, 3.0 * sizeof(*a));
+    record(name + "/solve_kernel", kernelSolve, sizeof(*a) + 2.0 * sizeof(rhs));
+    record(name + "/solve", blasSolve, sizeof(*a) + 2.0 * sizeof(rhs));
+    record(name + "/inverse_kernel", kernelInverse, 2.0 * sizeof(*a));
+    record(name + "/inverse", blasInverse, 2.0 * sizeof(*a));
+
+    std::printf("blas   %4dx%-4d gemm %10.1f us / %10.1f us  x%5.2f  solve %8.1f us / %8.1f us  x%5.2f  inverse %10.1f us / %10.1f us  x%5.2f\n",
+        N, N, kernelGemm / 1000, blasGemm / 1000, kernelGemm / blasGemm,
+        kernelSolve / 1000, blasSolve / 1000, kernelSolve / blasSolve,
+        kernelInverse / 1000, blasInverse / 1000, kernelInverse / blasInverse);
+}
+
+void benchRigidInverse(int iterations) {
+    float c = std::cos(0.3f), s = std::sin(0.3f);
+    la::Mat4 m = {{c, -s, 0, 1}, {s, c, 0, 2}, {0, 0, 1, 3}, {0, 0, 0, 1}};
+
+    double general = timeNs([&] {
+        la::Mat4 i = m.inverse();
+        doNotOptimize(i);
+    }, iterations);
+
+    double rigid = timeNs([&] {
+        la::Mat4 i = m.rigidInverse();
+        doNotOptimize(i);
+    }, iterations);
+
+    record("lu/4/rigid_inverse", rigid, 2 * sizeof(m));
+    std::printf("lu        4x4    rigid inverse %10.1f ns  general %10.1f ns  x%.1f\n",
+        rigid, general, general / rigid);
+}
+
+// one op per element of a short array, so the timing loop costs nothing per op
+void benchVec3Math(std::mt19937& rng, int iterations) {
+    constexpr std::size_t count = 1024;
+    std::uniform_real_distribution<float> dist(0.5f, 1.0f);
+
+    std::vector<la::Vec3> a(count), b(count), out(count);
+    std::vector<float> scalars(count);
+    for (std::size_t i = 0; i < count; i++) {
+        a[i] = {dist(rng), dist(rng), dist(rng)};
+        b[i] = {dist(rng), dist(rng), dist(rng)};
+    }
+
+    double add = timeNs([&] {
+        for (std::size_t i = 0; i < count; i++) out[i] = a[i] + b[i] * 0.5f;
+        doNotOptimize(out[0]);
+    }, iterations) / count;
+
+    double dot = timeNs([&] {
+        for (std::size_t i = 0; i < count; i++) scalars[i] = a[i].dot(b[i]);
+        doNotOptimize(scalars[0]);
+    }, iterations) / count;
+
+    double cross = timeNs([&] {
+        for (std::size_t i = 0; i < count; i++) out[i] = a[i].cross(b[i]);
+        doNotOptimize(out[0]);
+    }, iterations) / count;
+
+    double length = timeNs([&] {
+        for (std::size_t i = 0; i < count; i++) scalars[i] = a[i].length();
+        doNotOptimize(scalars[0]);
+    }, iterations) / count;
+
+    double normalize = timeNs([&] {
+        for (std::size_t i = 0; i < count; i++) out[i] = a[i].normalize();
+        doNotOptimize(out[0]);
+    }, iterations) / count;
+
+    record("vec3/add_scaled", add, 3.0 * sizeof(la::Vec3));
+    record("vec3/dot", dot, 2.0 * sizeof(la::Vec3) + sizeof(float));
+    record("vec3/cross", cross, 3.0 * sizeof(la::Vec3));
+    record("vec3/length", length, sizeof(la::Vec3) + sizeof(float));
+    record("vec3/normalize", normalize, 2.0 * sizeof(la::Vec3));
+
+    std::printf("vec3   per op  a+b*s %6.2f ns  dot %6.2f ns  cross %6.2f ns  length %6.2f ns  normalize %6.2f ns\n",
+        add, dot, cross, length, normalize);
+}
+
+void benchQuaternion(std::mt19937& rng, int iterations) {
+    constexpr std::size_t count = 1024;
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+
+    std::vector<la::Quat> qa(count), qb(count), qOut(count);
+    std::vector<la::Mat3> ma(count), mb(count), mOut(count);
+    std::vector<la::Vec3> v(count), vOut(count);
+    for (std::size_t i = 0; i < count; i++) {
+        qa[i] = la::Quat::axisAngle(la::Vec3{dist(rng), dist(rng), 1}.normalize(), dist(rng));
+        qb[i] = la::Quat::axisAngle(la::Vec3{1, dist(rng), dist(rng)}.normalize(), dist(rng));
+        ma[i] = qa[i].toMat3();
+        mb[i] = qb[i].toMat3();
+        v[i] = {dist(rng), dist(rng), dist(rng)};
+    }
+
+    double quatCompose = timeNs([&] {
+        la::compose(std::span<const la::Quat>(qa), std::span<const la::Quat>(qb), std::span<la::Quat>(qOut));
+        doNotOptimize(qOut[0][0]);
+    }, iterations) / count;
+
+    double matCompose = timeNs([&] {
+        for (std::size_t i = 0; i < count; i++) mOut[i] = ma[i] * mb[i];
+        doNotOptimize(mOut[0][0][0]);
+    }, iterations) / count;
+
+    double quatRotate = timeNs([&] {
+        for (std::size_t i = 0; i < count; i++) vOut[i] = qa[i].rotate(v[i]);
+        doNotOptimize(vOut[0][0]);
+    }, iterations) / count;
+
+    double batchRotate = timeNs([&] {
+        la::rotate(std::span<const la::Quat>(qa), std::span<const la::Vec3>(v), std::span<la::Vec3>(vOut));
+        doNotOptimize(vOut[0][0]);
+    }, iterations) / count;
+
+    double matRotate = timeNs([&] {
+        for (std::size_t i = 0; i < count; i++) vOut[i] = ma[i] * v[i];
+        doNotOptimize(vOut[0][0]);
+    }, iterations) / count;
+
+    double slerp = timeNs([&] {
+        la::slerp(std::span<const la::Quat>(qa), std::span<const la::Quat>(qb), 0.3f, std::span<la::Quat>(qOut));
+        doNotOptimize(qOut[0][0]);
+    }, iterations) / count;
+
+    record("quat/compose", quatCompose, 3.0 * sizeof(la::Quat));
+    record("quat/compose_mat3", matCompose, 3.0 * sizeof(la::Mat3));
+    record("quat/rotate", quatRotate, sizeof(la::Quat) + 2.0 * sizeof(la::Vec3));
+    record("quat/rotate_batch", batchRotate, sizeof(la::Quat) + 2.0 * sizeof(la::Vec3));
+    record("quat/rotate_mat3", matRotate, sizeof(la::Mat3) + 2.0 * sizeof(la::Vec3));
+    record("quat/slerp", slerp, 3.0 * sizeof(la::Quat));
+
+    std::printf("quat   per op  compose %6.2f ns (mat3 %6.2f ns)  rotate %6.2f ns  batched %6.2f ns (mat3 %6.2f ns)  slerp %6.2f ns\n",
+        quatCompose, matCompose, quatRotate, batchRotate, matRotate, slerp);
+}
+
+void benchAffine(std::mt19937& rng, int iterations) {
+    constexpr std::size_t count = 1024;
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+
+    std::vector<la::Affine3> a(count), b(count), out(count);
+    std::vector<la::Mat4> ma(count), mb(count), mOut(count);
+    std::vector<la::Vec3> points(count), moved(count);
+    std::vector<la::Vector<4>> homogeneous(count), movedH(count);
+    for (std::size_t i = 0; i < count; i++) {
+        randomize(a[i], rng);
+        randomize(b[i], rng);
+        ma[i] = a[i].toMat4();
+        mb[i] = b[i].toMat4();
+        points[i] = {dist(rng), dist(rng), dist(rng)};
+        homogeneous[i] = {points[i][0], points[i][1], points[i][2], 1};
+    }
+
+    double compose = timeNs([&] {
+        for (std::size_t i = 0; i < count; i++) out[i] = a[i] * b[i];
+        doNotOptimize(out[0][0][0]);
+    }, iterations) / count;
+
+    double composeMat4 = timeNs([&] {
+        for (std::size_t i = 0; i < count; i++) mOut[i] = ma[i] * mb[i];
+        doNotOptimize(mOut[0][0][0]);
+    }, iterations) / count;
+
+    double point = timeNs([&] {
+        for (std::size_t i = 0; i < count; i++) moved[i] = a[i].transformPoint(points[i]);
+        doNotOptimize(moved[0][0]);
+    }, iterations) / count;
+
+    double pointMat4 = timeNs([&] {
+        for (std::size_t i = 0; i < count; i++) movedH[i] = ma[i] * homogeneous[i];
+        doNotOptimize(movedH[0][0]);
+    }, iterations) / count;
+
+    double inverse = timeNs([&] {
+        for (std::size_t i = 0; i < count; i++) out[i] = a[i].inverse();
+        doNotOptimize(out[0][0][0]);
+    }, iterations) / count;
+
+    double inverseMat4 = timeNs([&] {
+        for (std::size_t i = 0; i < count; i++) mOut[i] = ma[i].inverse();
+        doNotOptimize(mOut[0][0][0]);
+    }, iterations) / count;
+
+    record("affine/compose", compose, 3.0 * sizeof(la::Affine3));
+    record("affine/compose_mat4", composeMat4, 3.0 * sizeof(la::Mat4));
+    record("affine/point", point, sizeof(la::Affine3) + 2.0 * sizeof(la::Vec3));
+    record("affine/point_mat4", pointMat4, sizeof(la::Mat4) + 2.0 * sizeof(la::Vector<4>));
+    record("affine/inverse", inverse, 2.0 * sizeof(la::Affine3));
+    record("affine/inverse_mat4", inverseMat4, 2.0 * sizeof(la::Mat4));
+
+    std::printf("affine per op  compose %6.2f ns (mat4 %6.2f ns)  point %6.2f ns (mat4 %6.2f ns)  inverse %6.2f ns (mat4 %6.2f ns)\n",
+        compose, composeMat4, point, pointMat4, inverse, inverseMat4);
+}
+
+void benchMat4Vec4(std::mt19937& rng, int iterations) {
+    constexpr std::size_t count = 1024;
+
+    la::Mat4 m;
+    randomize(m, rng);
+    std::vector<la::Vec4> in(count), out(count);
+    for (la::Vec4& v : in) randomize(v, rng);
+
+    double single = timeNs([&] {
+        for (std::size_t i = 0; i < count; i++) out[i] = m * in[i];
+        doNotOptimize(out[0]);
+    }, iterations) / count;
+
+    double batched = timeNs([&] {
+        la::transform<la::Vec4>(m, in, out);
+        doNotOptimize(out[0]);
+    }, iterations) / count;
+
+    la::Mat4 n;
+    randomize(n, rng);
+    double product = timeNs([&] {
+        la::Mat4 r = m * n;
+        doNotOptimize(r);
+    }, iterations * 64);
+
+    record("mat4/mul_vec4", single, 2.0 * sizeof(la::Vec4));
+    record("mat4/mul_vec4_batched", batched, 2.0 * sizeof(la::Vec4));
+    record("mat4/mul_mat4", product, 3.0 * sizeof(la::Mat4));
+
+    std::printf("mat4   per op  m*v %6.2f ns  transform span %6.2f ns  m*m %6.2f ns\n", single, batched, product);
+}
+
+template <int N>
+void benchTranspose(std::mt19937& rng, int iterations) {
+    auto m = std::make_unique<la::Matrix<N, N>>();
+    auto r = std::make_unique<la::Matrix<N, N>>();
+    randomize(*m, rng);
+
+    double transpose = timeNs([&] {
+        *r = m->transpose();
+        doNotOptimize((*r)[0][0]);
+    }, iterations);
+
+    record("transpose/" + std::to_string(N), transpose, 2.0 * sizeof(*m));
+
+    std::printf("trans  %4dx%-4d %10.1f ns (%5.2f GB/s)\n", N, N, transpose, 2.0 * sizeof(*m) / transpose);
+}
+
+// the pre-accessor Vec3 layout, kept here for comparison
+struct ReferenceVec3 : la::Vector<3> {
+    ReferenceVec3() = default;
+    ReferenceVec3(const ReferenceVec3& other) : la::Vector<3>(other) {}
+    ReferenceVec3& operator=(const ReferenceVec3& other) {
+        la::Vector<3>::operator=(other);
+        return *this;
+    }
+
+    float& x = elements[0];
+    float& y = elements[1];
+    float& z = elements[2];
+};
+
+template <typename V>
+double benchPointArray(std::vector<V>& points, int iterations) {
+    return timeNs([&] {
+        float total = 0;
+        for (V& p : points) {
+            float inv = 1 / std::sqrt(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]);
+            p[0] *= inv;
+            p[1] *= inv;
+            p[2] *= inv;
+            total += p[0];
+        }
+        doNotOptimize(total);
+    }, iterations);
+}
+
+void benchVec3Layout(std::mt19937& rng, int iterations) {
+    constexpr std::size_t count = 1000000;
+    std::uniform_real_distribution<float> dist(0.5f, 1.0f);
+
+    std::vector<la::Vec3> packed(count);
+    std::vector<ReferenceVec3> referenced(count);
+    for (std::size_t i = 0; i < count; i++) {
+        for (int c = 0; c < 3; c++) {
+            packed[i][c] = referenced[i][c] = dist(rng);
+        }
+    }
+
+    double tPacked = benchPointArray(packed, iterations);
+    double tReferenced = benchPointArray(referenced, iterations);
+
+    record("vec3/normalize_1m/packed", tPacked, 2.0 * count * sizeof(la::Vec3));
+    record("vec3/normalize_1m/references", tReferenced, 2.0 * count * sizeof(ReferenceVec3));
+
+    std::printf("vec3   normalize 1M points  packed (%zu B) %10.1f us  references (%zu B) %10.1f us  x%.2f\n",
+        sizeof(la::Vec3), tPacked / 1000, sizeof(ReferenceVec3), tReferenced / 1000, tReferenced / tPacked);
+}
+
+void benchFusedExpression(std::mt19937& rng, int iterations) {
+    using T = la::Tensor<64, 64, 64>;
+    auto a = std::make_unique<T>();
+    auto b = std::make_unique<T>();
+    auto r = std::make_unique<T>();
+    auto tmp1 = std::make_unique<T>();
+    auto tmp2 = std::make_unique<T>();
+    randomize(*a, rng);
+    randomize(*b, rng);
+
+    float* pa = a->data();
+    float* pb = b->data();
+    float* pr = r->data();
+    float* p1 = tmp1->data();
+    float* p2 = tmp2->data();
+    constexpr std::size_t n = T::count;
+
+    // what the eager operators did: one full temporary per operator
+    double eager = timeNs([&] {
+        for (std::size_t i = 0; i < n; i++) p1[i] = pa[i] * 0.25f;
+        for (std::size_t i = 0; i < n; i++) p2[i] = pb[i] * 0.75f;
+        for (std::size_t i = 0; i < n; i++) pr[i] = p1[i] + p2[i];
+        doNotOptimize(*r);
+    }, iterations);
+
+    double fused = timeNs([&] {
+        *r = *a * 0.25f + *b * 0.75f;
+        doNotOptimize(*r);
+    }, iterations);
+
+    record("expr/64^3/eager", eager, 7.0 * sizeof(T));
+    record("expr/64^3/fused", fused, 3.0 * sizeof(T));
+
+    std::printf("expr   a*s + b*t on 64x64x64  eager temporaries %10.1f us  fused %10.1f us  x%.2f\n",
+        eager / 1000, fused / 1000, eager / fused);
+
+    // rows of 3 floats are shorter than a packet, only a flat loop vectorizes them
+    using S = la::Tensor<3, 65536>;
+    auto c = std::make_unique<S>();
+    auto d = std::make_unique<S>();
+    auto e = std::make_unique<S>();
+    randomize(*c, rng);
+    randomize(*d, rng);
+
+    double rows = timeNs([&] {
+        for (std::size_t j = 0; j < 65536; j++) {
+            (*e)[j] = (*c)[j] * 0.25f + (*d)[j] * 0.75f;
+        }
+        doNotOptimize(*e);
+    }, iterations);
+
+    double flat = timeNs([&] {
+        *e = *c * 0.25f + *d * 0.75f;
+        doNotOptimize(*e);
+    }, iterations);
+
+    record("expr/3x65536/rows", rows, 3.0 * sizeof(S));
+    record("expr/3x65536/flat", flat, 3.0 * sizeof(S));
+
+    std::printf("expr   a*s + b*t on 3x65536   row by row        %10.1f us  flat  %10.1f us  x%.2f\n",
+        rows / 1000, flat / 1000, rows / flat);
+}
+
+template <int D>
+void benchVectorKernels(std::mt19937& rng, int iterations) {
+    la::Vector<D> a, b, c;
+    randomize(a, rng);
+    randomize(b, rng);
+    const float* pa = &a[0];
+    const float* pb = &b[0];
+    float* pc = &c[0];
+
+    double dotScalar = timeNs([&] {
+        float s = 0;
+        for (int i = 0; i < D; i++) s += pa[i] * pb[i];
+        doNotOptimize(s);
+    }, iterations);
+
+    double dotSimd = timeNs([&] {
+        float s = a.dot(b);
+        doNotOptimize(s);
+    }, iterations);
+
+    double sumScalar = timeNs([&] {
+        float s = 0;
+        for (int i = 0; i < D; i++) s += pa[i];
+        doNotOptimize(s);
+    }, iterations);
+
+    double sumSimd = timeNs([&] {
+        float s = a.sum();
+        doNotOptimize(s);
+    }, iterations);
+
+    double addScalar = timeNs([&] {
+        for (int i = 0; i < D; i++) pc[i] = pa[i] + pb[i] * 2.0f;
+        doNotOptimize(c);
+    }, iterations);
+
+    double addSimd = timeNs([&] {
+        c = a + b * 2.0f;
+        doNotOptimize(c);
+    }, iterations);
+
+    std::string name = "vector/" + std::to_string(D);
+    record(name + "/dot", dotSimd, 2.0 * sizeof(a));
+    record(name + "/sum", sumSimd, sizeof(a));
+    record(name + "/axpy", addSimd, 3.0 * sizeof(a));
+
+    std::printf("vector D=%-5d dot %8.1f -> %8.1f ns (x%.2f)  sum %8.1f -> %8.1f ns (x%.2f)  a+b*s %8.1f -> %8.1f ns (x%.2f)\n",
+        D, dotScalar, dotSimd, dotScalar / dotSimd, sumScalar, sumSimd, sumScalar / sumSimd,
+        addScalar, addSimd, addScalar / addSimd);
+}
+
+void benchVec3Batch(std::mt19937& rng, int iterations) {
+    constexpr std::size_t count = 1000000;
+    std::uniform_real_distribution<float> dist(0.5f, 1.0f);
+
+    std::vector<la::Vec3> points(count), others(count);
+    for (std::size_t i = 0; i < count; i++) {
+        points[i] = {dist(rng), dist(rng), dist(rng)};
+        others[i] = {dist(rng), dist(rng), dist(rng)};
+    }
+    std::vector<float> dots(count);
+
+    la::Vec3Batch batch{std::span<const la::Vec3>(points)};
+    la::Vec3Batch otherBatch{std::span<const la::Vec3>(others)};
+    la::Vec3Batch out(count);
+
+    double aosNormalize = timeNs([&] {
+        for (la::Vec3& p : points) p = p.normalize();
+        doNotOptimize(points[0]);
+    }, iterations);
+
+    double soaNormalize = timeNs([&] {
+        batch.normalize(out);
+        doNotOptimize(out);
+    }, iterations);
+
+    double aosCross = timeNs([&] {
+        for (std::size_t i = 0; i < count; i++) points[i] = points[i].cross(others[i]);
+        doNotOptimize(points[0]);
+    }, iterations);
+
+    double soaCross = timeNs([&] {
+        batch.cross(otherBatch, out);
+        doNotOptimize(out);
+    }, iterations);
+
+    double aosDot = timeNs([&] {
+        for (std::size_t i = 0; i < count; i++) dots[i] = points[i].dot(others[i]);
+        doNotOptimize(dots[0]);
+    }, iterations);
+
+    double soaDot = timeNs([&] {
+        batch.dot(otherBatch, dots);
+        doNotOptimize(dots[0]);
+    }, iterations);
+
+    record("batch/vec3_1m/normalize", soaNormalize, 6.0 * count * sizeof(float));
+    record("batch/vec3_1m/cross", soaCross, 9.0 * count * sizeof(float));
+    record("batch/vec3_1m/dot", soaDot, 7.0 * count * sizeof(float));
+
+    std::printf("batch  1M Vec3  normalize %8.1f -> %8.1f us  cross %8.1f -> %8.1f us  dot %8.1f -> %8.1f us\n",
+        aosNormalize / 1000, soaNormalize / 1000, aosCross / 1000, soaCross / 1000, aosDot / 1000, soaDot / 1000);
+}
+
+void benchTransform(std::mt19937& rng, int iterations) {
+    constexpr std::size_t count = 4000000;
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+
+    la::Mat4 m;
+    randomize(m, rng);
+    std::vector<la::Vec3> points(count), out(count);
+    for (la::Vec3& p : points) p = {dist(rng), dist(rng), dist(rng)};
+
+    double scalar = timeNs([&] {
+        for (std::size_t i = 0; i < count; i++) {
+            la::Vector<4> r = m * points[i].extend(1);
+            out[i] = {r[0], r[1], r[2]};
+        }
+        doNotOptimize(out[0]);
+    }, iterations);
+
+    double single = timeNs([&] {
+        for (std::size_t i = 0; i < count; i += la::TRANSFORM_PARALLEL_THRESHOLD / 2) {
+            std::size_t n = count - i < la::TRANSFORM_PARALLEL_THRESHOLD / 2 ? count - i : la::TRANSFORM_PARALLEL_THRESHOLD / 2;
+            la::transformPoints<la::Vec3>(m, std::span(points).subspan(i, n), std::span(out).subspan(i, n));
+        }
+        doNotOptimize(out[0]);
+    }, iterations);
+
+    double threaded = timeNs([&] {
+        la::transformPoints<la::Vec3>(m, points, out);
+        doNotOptimize(out[0]);
+    }, iterations);
+
+    record("transform/vec3_4m/loop", scalar, 2.0 * count * sizeof(la::Vec3));
+    record("transform/vec3_4m/batched", single, 2.0 * count * sizeof(la::Vec3));
+    record("transform/vec3_4m/threaded", threaded, 2.0 * count * sizeof(la::Vec3));
+
+    std::printf("xform  4M points by Mat4  m*v loop %8.1f us  batched %8.1f us  batched+threads(%zu) %8.1f us\n",
+        scalar / 1000, single / 1000, la::ThreadPool::instance().concurrency(), threaded / 1000);
+}
+
+void benchDynamicTemporaries(int iterations) {
+    std::vector<std::size_t> shape = {256, 256, 16};
+    la::DynamicTensor a(shape, 1.0f), b(shape, 2.0f);
+
+    // each operator allocates its result from the left operand's resource
+    double heap = timeNs([&] {
+        la::DynamicTensor r = a * 0.5f + b * 0.25f;
+        doNotOptimize(r.data()[0]);
+    }, iterations);
+
+    la::Pool pool;
+    la::DynamicTensor pa(a, &pool), pb(b, &pool);
+    double pooled = timeNs([&] {
+        la::DynamicTensor r = pa * 0.5f + pb * 0.25f;
+        doNotOptimize(r.data()[0]);
+    }, iterations);
+
+    record("dynamic/256x256x16/heap", heap, 3.0 * a.size() * sizeof(float));
+    record("dynamic/256x256x16/pool", pooled, 3.0 * a.size() * sizeof(float));
+
+    std::printf("dyn    a*s + b*t on 256x256x16  new/delete %8.1f us  pool %8.1f us\n",
+        heap / 1000, pooled / 1000);
+}
+
+// the element by element permute that predates StridedView, kept here for comparison.
+// It took the tensor by value, which overflows the stack at 128^3, so this one does not
+template <std::size_t N>
+bool referenceIncrement(std::array<std::size_t, N>& indices, const std::array<std::size_t, N>& shape) {
+    for (int i = N - 1; i >= 0; --i) {
+        if (++indices[i] < shape[i])
+            return true;
+        indices[i] = 0;
+    }
+    return false;
+}
+
+template <int D1, int D2, int... D>
+void referencePermute(la::Tensor<D...>& tensor, la::TensorT<typename la::SwapItems<la::NumList<D...>, D1, D2>::value>& out) {
+    std::array<std::size_t, sizeof...(D)> indices;
+    std::array<std::size_t, sizeof...(D)> shape = tensor.shape();
+    indices.fill(0);
+
+    do {
+        std::array<std::size_t, sizeof...(D)> swapped = indices;
+        std::swap(swapped[D1], swapped[D2]);
+        out.getList(swapped) = tensor.getList(indices);
+    } while (referenceIncrement(indices, shape));
+}
+
+template <int D1, int D2>
+void benchPermute(std::mt19937& rng, int iterations) {
+    using T = la::Tensor<128, 128, 128>;
+    using P = la::TensorT<typename la::SwapItems<la::NumList<128, 128, 128>, D1, D2>::value>;
+    auto a = std::make_unique<T>();
+    auto out = std::make_unique<P>();
+    auto sum = std::make_unique<P>();
+    randomize(*a, rng);
+
+    double reference = timeNs([&] {
+        referencePermute<D1, D2>(*a, *out);
+        doNotOptimize((*out)[0][0][0]);
+    }, iterations);
+
+    double tiled = timeNs([&] {
+        *out = a->template __permute<D1, D2>();
+        doNotOptimize((*out)[0][0][0]);
+    }, iterations);
+
+    // the view is read in place by the expression, no permuted copy is made
+    double fused = timeNs([&] {
+        *sum = a->template __permute<D1, D2>() + *out;
+        doNotOptimize((*sum)[0][0][0]);
+    }, iterations);
+
+    double bytes = 2.0 * sizeof(T);
+    std::string name = "permute/128^3/" + std::to_string(D1) + std::to_string(D2);
+    record(name + "/getlist", reference, bytes);
+    record(name + "/tiled", tiled, bytes);
+    record(name + "/view_plus_tensor", fused, 3.0 * sizeof(T));
+
+    std::printf("perm   128^3 permute(%d, %d)  getList %9.1f us  tiled view %9.1f us (%5.2f GB/s) x%.1f  view + t %9.1f us\n",
+        D1, D2, reference / 1000, tiled / 1000, bytes / tiled, reference / tiled, fused / 1000);
+}
+
+void benchContraction(std::mt19937& rng, int iterations) {
+    auto t = std::make_unique<la::Tensor<64, 64, 64>>();
+    auto w = std::make_unique<la::Tensor<64, 64>>();
+    auto r = std::make_unique<la::Tensor<64, 64, 64>>();
+    randomize(*t, rng);
+    randomize(*w, rng);
+
+    // R_wyx = T_xyz W_zw written out by hand
+    double loops = timeNs([&] {
+        for (int x = 0; x < 64; x++)
+            for (int y = 0; y < 64; y++)
+                for (int q = 0; q < 64; q++) {
+                    float sum = 0;
+                    for (int z = 0; z < 64; z++)
+                        sum += (*t)[z][y][x] * (*w)[q][z];
+                    (*r)[x][y][q] = sum;
+                }
+        doNotOptimize((*r)[0][0][0]);
+    }, iterations);
+
+    double contracted = timeNs([&] {
+        *r = la::contract<la::Labels<'x', 'y', 'z'>, la::Labels<'z', 'w'>, la::Labels<'w', 'y', 'x'>>(*t, *w);
+        doNotOptimize((*r)[0][0][0]);
+    }, iterations);
+
+    record("contract/xyz_zw_wyx/loops", loops, 2.0 * sizeof(*t) + sizeof(*w));
+    record("contract/xyz_zw_wyx/gemm", contracted, 2.0 * sizeof(*t) + sizeof(*w));
+
+    double flops = 2.0 * 64 * 64 * 64 * 64;
+    std::printf("einsum xyz,zw->wyx 64^3 x 64^2  loops %9.1f us (%5.2f GFLOP/s)  contract %9.1f us (%5.2f GFLOP/s)  x%.1f\n",
+        loops / 1000, flops / loops, contracted / 1000, flops / contracted, loops / contracted);
+}
+
+void benchParallel(std::mt19937& rng, int iterations) {
+    using T = la::Tensor<256, 256, 256>;
+    auto a = std::make_unique<T>();
+    auto b = std::make_unique<T>();
+    auto r = std::make_unique<T>();
+    randomize(*a, rng);
+    randomize(*b, rng);
+
+    double serial = timeNs([&] {
+        la::assign(la::seq, *r, *a * 0.5f + *b);
+        doNotOptimize((*r)[0][0][0]);
+    }, iterations);
+
+    double parallel = timeNs([&] {
+        la::assign(la::par, *r, *a * 0.5f + *b);
+        doNotOptimize((*r)[0][0][0]);
+    }, iterations);
+
+    double serialSum = timeNs([&] {
+        float s = la::sum(la::seq, *a);
+        doNotOptimize(s);
+    }, iterations);
+
+    double parallelSum = timeNs([&] {
+        float s = la::sum(la::par, *a);
+        doNotOptimize(s);
+    }, iterations);
+
+    record("elementwise/256^3/seq", serial, 3.0 * sizeof(T));
+    record("elementwise/256^3/par", parallel, 3.0 * sizeof(T));
+    record("sum/256^3/seq", serialSum, sizeof(T));
+    record("sum/256^3/par", parallelSum, sizeof(T));
+
+    double serialDot = timeNs([&] {
+        float s = la::dot(la::seq, *a, *b);
+        doNotOptimize(s);
+    }, iterations);
+
+    double parallelDot = timeNs([&] {
+        float s = la::dot(la::par, *a, *b);
+        doNotOptimize(s);
+    }, iterations);
+
+    record("dot/256^3/seq", serialDot, 2.0 * sizeof(T));
+    record("dot/256^3/par", parallelDot, 2.0 * sizeof(T));
+
+    std::printf("par    256^3 threads %zu  a*s + b  seq %8.1f us  par %8.1f us  x%.2f  sum  seq %8.1f us  par %8.1f us  x%.2f\n",
+        la::ThreadPool::instance().concurrency(), serial / 1000, parallel / 1000, serial / parallel,
+        serialSum / 1000, parallelSum / 1000, serialSum / parallelSum);
+    std::printf("par    256^3 dot  seq %8.1f us  par %8.1f us  x%.2f\n",
+        serialDot / 1000, parallelDot / 1000, serialDot / parallelDot);
+}
+
+void benchReduction(std::mt19937& rng, int iterations) {
+    using T = la::Tensor<256, 256, 64>;
+    auto a = std::make_unique<T>();
+    auto r = std::make_unique<la::Tensor<256, 64>>();
+    randomize(*a, rng);
+
+    // every axis reduced by hand, the inner loop walking the reduced axis
+    double loops0 = timeNs([&] {
+        for (int z = 0; z < 64; z++)
+            for (int y = 0; y < 256; y++) {
+                float sum = 0;
+                for (int x = 0; x < 256; x++)
+                    sum += (*a)[z][y][x];
+                (*r)[z][y] = sum;
+            }
+        doNotOptimize((*r)[0][0]);
+    }, iterations);
+
+    double loops1 = timeNs([&] {
+        for (int z = 0; z < 64; z++)
+            for (int x = 0; x < 256; x++) {
+                float sum = 0;
+                for (int y = 0; y < 256; y++)
+                    sum += (*a)[z][y][x];
+                (*r)[z][x] = sum;
+            }
+        doNotOptimize((*r)[0][0]);
+    }, iterations);
+
+    double reduced0 = timeNs([&] {
+        *r = la::sum<0>(*a);
+        doNotOptimize((*r)[0][0]);
+    }, iterations);
+
+    double reduced1 = timeNs([&] {
+        *r = la::sum<1>(*a);
+        doNotOptimize((*r)[0][0]);
+    }, iterations);
+
+    record("reduce/sum0/loops", loops0, sizeof(T));
+    record("reduce/sum0/simd", reduced0, sizeof(T));
+    record("reduce/sum1/loops", loops1, sizeof(T));
+    record("reduce/sum1/simd", reduced1, sizeof(T));
+
+    std::printf("reduce 256x256x64 sum<0>  loops %8.1f us  simd %8.1f us  x%.1f  sum<1>  loops %8.1f us  simd %8.1f us  x%.1f\n",
+        loops0 / 1000, reduced0 / 1000, loops0 / reduced0, loops1 / 1000, reduced1 / 1000, loops1 / reduced1);
+
+    // relative error of a float sum of 2^22 tenths against the exact value
+    auto tenths = std::make_unique<la::Tensor<1 << 22>>();
+    for (int i = 0; i < 1 << 22; i++) {
+        (*tenths)[i] = 0.1f;
+    }
+    double exact = double(0.1f) * (1 << 22);
+    float naive = 0;
+    for (int i = 0; i < 1 << 22; i++) {
+        naive += (*tenths)[i];
+    }
+    std::printf("reduce 2^22 x 0.1f  relative error  naive %.2e  sum %.2e\n",
+        std::abs(naive - exact) / exact, std::abs(la::sum(*tenths) - exact) / exact);
+}
+
+void benchTensorFile(std::mt19937& rng, int iterations) {
+    using T = la::Tensor<1024, 4096>;
+    auto a = std::make_unique<T>();
+    auto b = std::make_unique<T>();
+    randomize(*a, rng);
+    std::string path = (std::filesystem::temp_directory_path() / "linalg_bench.ltf").string();
+
+    double save = timeNs([&] {
+        la::saveTensor(path, *a);
+    }, iterations);
+
+    // mapping alone is lazy, so both loads are timed up to a sum over every element
+    double mapped = timeNs([&] {
+        la::MappedTensor file(path);
+        float s = la::sum(file.as<float, 1024, 4096>());
+        doNotOptimize(s);
+    }, iterations);
+
+    double copied = timeNs([&] {
+        la::loadTensor(path, *b);
+        float s = la::sum(*b);
+        doNotOptimize(s);
+    }, iterations);
+
+    double raw = timeNs([&] {
+        std::FILE* file = std::fopen(path.c_str(), "rb");
+        std::vector<char> buffer(sizeof(T) + 4096);
+        std::size_t read = std::fread(buffer.data(), 1, buffer.size(), file);
+        std::fclose(file);
+        doNotOptimize(buffer[read - 1]);
+    }, iterations);
+
+    std::filesystem::remove(path);
+
+    record("io/16MB/save", save, sizeof(T));
+    record("io/16MB/map_sum", mapped, sizeof(T));
+    record("io/16MB/load_sum", copied, 2.0 * sizeof(T));
+    record("io/16MB/fread", raw, sizeof(T));
+
+    std::printf("io     16 MB  save %8.1f us  map+sum %8.1f us  load+sum %8.1f us  fread only %8.1f us\n",
+        save / 1000, mapped / 1000, copied / 1000, raw / 1000);
+}
+
+void benchFormat(std::mt19937& rng, int iterations) {
+    using T = la::Tensor<64, 64, 16>;
+    auto a = std::make_unique<T>();
+    auto b = std::make_unique<T>();
+    randomize(*a, rng);
+    const float* elements = &(*a)[0][0][0];
+    constexpr std::size_t count = 64 * 64 * 16;
+
+    // what Vector::string used to do per element
+    double streamed = timeNs([&] {
+        std::stringstream stream;
+        for (std::size_t i = 0; i < count; i++) {
+            stream << std::fixed << std::setprecision(6) << elements[i] << ", ";
+        }
+        doNotOptimize(stream.str()[0]);
+    }, iterations);
+
+    std::vector<char> buffer(count * 32);
+    std::size_t length = 0;
+    double formatted = timeNs([&] {
+        std::to_chars_result written = la::format(buffer.data(), buffer.data() + buffer.size(), *a);
+        length = written.ptr - buffer.data();
+        doNotOptimize(buffer[0]);
+    }, iterations);
+
+    double shortest = timeNs([&] {
+        std::to_chars_result written = la::format(buffer.data(), buffer.data() + buffer.size(), *a, {la::SHORTEST});
+        length = written.ptr - buffer.data();
+        doNotOptimize(buffer[0]);
+    }, iterations);
+
+    std::string text(buffer.data(), length);
+    double extracted = timeNs([&] {
+        std::istringstream stream(text);
+        float* out = &(*b)[0][0][0];
+        char c;
+        for (std::size_t i = 0; i < count; i++) {
+            while (stream.get(c) && (c == '(' || c == ')' || c == ',' || c == ' ')) {}
+            stream.unget();
+            stream >> out[i];
+        }
+        doNotOptimize(out[0]);
+    }, iterations);
+
+    double parsed = timeNs([&] {
+        la::parse(text.data(), text.data() + text.size(), *b);
+        doNotOptimize((*b)[0][0][0]);
+    }, iterations);
+
+    record("format/64x64x16/stringstream", streamed, sizeof(T));
+    record("format/64x64x16/to_chars", formatted, sizeof(T));
+    record("format/64x64x16/shortest", shortest, sizeof(T));
+    record("format/64x64x16/istream", extracted, sizeof(T));
+    record("format/64x64x16/from_chars", parsed, sizeof(T));
+
+    std::printf("format 64K floats  stringstream %8.1f us  to_chars %8.1f us  shortest %8.1f us  x%.1f\n",
+        streamed / 1000, formatted / 1000, shortest / 1000, streamed / formatted);
+    std::printf("format 64K floats  istream %8.1f us  from_chars %8.1f us  x%.1f\n",
+        extracted / 1000, parsed / 1000, extracted / parsed);
+}
+
+// 5 point (2D) or 7 point (3D) Laplacian of a side^dims grid, entries in row order
+la::SparseTriplets laplacian(std::size_t side, int dims) {
+    std::size_t n = dims == 2 ? side * side : side * side * side;
+    la::SparseTriplets triplets(n, n);
+    triplets.reserve(n * (2 * dims + 1));
+
+    for (std::size_t i = 0; i < n; i++) {
+        triplets.add(i, i, 2.0f * dims);
+        for (std::size_t d = 0, step = 1; d < std::size_t(dims); d++, step *= side) {
+            std::size_t coordinate = i / step % side;
+            if (coordinate > 0) triplets.add(i, i - step, -1);
+            if (coordinate + 1 < side) triplets.add(i, i + step, -1);
+        }
+    }
+
+    return triplets;
+}
+
+void benchSparse(std::mt19937& rng, std::size_t side, int dims, int iterations) {
+    la::SparseTriplets triplets = laplacian(side, dims);
+
+    la::CsrMatrix csr;
+    double assembly = timeNs([&] {
+        csr = la::CsrMatrix(triplets);
+    }, 1);
+    la::CscMatrix csc(csr);
+
+    std::size_t n = csr.rows();
+    std::size_t nnz = csr.nonZeros();
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<float> x(n), y(n);
+    for (float& v : x) {
+        v = dist(rng);
+    }
+
+    // the usual CSR loop, 64 bit indices and no packets
+    std::vector<std::size_t> wideIndices(csr.indices().begin(), csr.indices().end());
+    const std::size_t* offsets = csr.offsets().data();
+    const float* values = csr.values().data();
+    double reference = timeNs([&] {
+        for (std::size_t i = 0; i < n; i++) {
+            float total = 0;
+            for (std::size_t e = offsets[i]; e < offsets[i + 1]; e++) {
+                total += values[e] * x[wideIndices[e]];
+            }
+            y[i] = total;
+        }
+        doNotOptimize(y[0]);
+    }, iterations);
+
+    double serial = timeNs([&] {
+        la::multiply(la::seq, csr, x, y);
+        doNotOptimize(y[0]);
+    }, iterations);
+
+    double parallel = timeNs([&] {
+        la::multiply(la::par, csr, x, y);
+        doNotOptimize(y[0]);
+    }, iterations);
+
+    double scatter = timeNs([&] {
+        la::multiply(la::seq, csc, x, y);
+        doNotOptimize(y[0]);
+    }, iterations);
+
+    // sparse x dense with 16 right hand sides, against 16 products with one vector
+    constexpr std::size_t k = 16;
+    std::vector<float> b(n * k), c(n * k);
+    for (float& v : b) {
+        v = dist(rng);
+    }
+    double multi = timeNs([&] {
+        la::multiply(la::par, csr, b, c, k);
+        doNotOptimize(c[0]);
+    }, iterations);
+
+    // values, 32 bit indices, offsets, x and y, x assumed to stay in cache
+    double bytes = nnz * (sizeof(float) + sizeof(std::int32_t)) + (n + 1) * sizeof(std::size_t) + 2.0 * n * sizeof(float);
+    double wideBytes = bytes + nnz * (sizeof(std::size_t) - sizeof(std::int32_t));
+
+    std::string name = "sparse/laplacian" + std::to_string(dims) + "d/" + std::to_string(n);
+    record(name + "/assembly", assembly, nnz * (2 * sizeof(std::size_t) + sizeof(float)));
+    record(name + "/spmv_reference", reference, wideBytes);
+    record(name + "/spmv", serial, bytes);
+    record(name + "/spmv_par", parallel, bytes);
+    record(name + "/spmv_csc", scatter, bytes);
+    record(name + "/spmm8_par", multi, bytes + 2.0 * n * k * sizeof(float));
+
+    std::printf("sparse %dD Laplacian %7zu rows %8zu nnz  assembly %8.1f ms  spmv reference %8.1f us  csr %8.1f us (%5.2f GB/s)  par %8.1f us  x%.1f  csc %8.1f us  x%zu dense (par) %8.1f us  x%.1f\n",
+        dims, n, nnz, assembly / 1e6, reference / 1000, serial / 1000, bytes / serial, parallel / 1000,
+        reference / parallel, scatter / 1000, k, multi / 1000, k * serial / multi);
+}
+
+// iterations and time to a relative residual of 1e-5 on a 2D Laplacian, plus the matrix alone
+template <typename Solver, typename Preconditioner>
+void benchSolve(const char* name, Solver& solver, const la::CsrMatrix& a, const Preconditioner& m,
+    std::span<const float> b, std::vector<float>& x, std::size_t side, int iterations) {
+    la::SolverReport report;
+    double solve = timeNs([&] {
+        std::fill(x.begin(), x.end(), 0.0f);
+        report = solver.solve(la::par, a, b, x, m);
+        doNotOptimize(x[0]);
+    }, iterations);
+
+    record("solver/laplacian2d/" + std::to_string(side) + "/" + name, solve, a.nonZeros() * 8.0 * report.iterations);
+    std::printf("solver %3zux%-3zu Laplacian  %-16s %5zu iterations  residual %.1e %s  %10.1f ms\n",
+        side, side, name, report.iterations, report.residual, report.converged ? "converged" : "stopped  ", solve / 1e6);
+}
+
+void benchSolvers(std::size_t side, int iterations) {
+    la::CsrMatrix a(laplacian(side, 2));
+    std::vector<float> b(a.rows(), 1.0f), x(a.rows());
+
+    la::SolverOptions options = {.tolerance = 1e-5f, .maxIterations = 5000};
+    la::ConjugateGradient cg(options);
+    la::BiCgStab bicgstab(options);
+    la::Gmres gmres(options);
+    la::IdentityPreconditioner none;
+
+    double setup = timeNs([&] {
+        la::Ilu0Preconditioner ilu(a);
+        doNotOptimize(ilu.factors().values()[0]);
+    }, iterations);
+    la::JacobiPreconditioner jacobi(a);
+    la::Ilu0Preconditioner ilu(a);
+    std::printf("solver %3zux%-3zu Laplacian  ILU(0) factorization %.1f ms\n", side, side, setup / 1e6);
+
+    benchSolve("cg", cg, a, none, b, x, side, iterations);
+    benchSolve("cg_jacobi", cg, a, jacobi, b, x, side, iterations);
+    benchSolve("cg_ilu0", cg, a, ilu, b, x, side, iterations);
+    benchSolve("bicgstab_ilu0", bicgstab, a, ilu, b, x, side, iterations);
+    benchSolve("gmres30_ilu0", gmres, a, ilu, b, x, side, iterations);
+}
+
+// what solving used to cost, a dense inverse or LU against CG on the same 256 unknowns
+void benchSolverDense(int iterations) {
+    constexpr int N = 256;
+    la::CsrMatrix sparse(laplacian(16, 2));
+    auto dense = std::make_unique<la::Matrix<N, N>>();
+    la::DynamicTensor full = sparse.dense();
+    std::copy(full.data(), full.data() + full.size(), dense->data());
+
+    la::Vector<N> b = 1.0f;
+    la::Vector<N> x;
+
+    double inverse = timeNs([&] {
+        x = dense->inverse() * b;
+        doNotOptimize(x);
+    }, iterations);
+
+    double lu = timeNs([&] {
+        x = dense->solve(b);
+        doNotOptimize(x);
+    }, iterations);
+
+    la::ConjugateGradient cg;
+    la::Ilu0Preconditioner ilu(sparse);
+    double iterative = timeNs([&] {
+        x = 0.0f;
+        cg.solve(sparse, b.span(), x.span(), ilu);
+        doNotOptimize(x);
+    }, iterations);
+
+    record("solver/dense256/inverse", inverse, 2.0 * sizeof(*dense));
+    record("solver/dense256/lu", lu, 2.0 * sizeof(*dense));
+    record("solver/dense256/cg_ilu0", iterative, sparse.nonZeros() * 8.0);
+
+    std::printf("solver 16x16 Laplacian as Matrix<256, 256>  inverse() * b %9.1f us  solve (LU) %9.1f us  sparse CG + ILU(0) %7.1f us  x%.0f\n",
+        inverse / 1000, lu / 1000, iterative / 1000, inverse / iterative);
+}
+
+int main(int argc, char** argv) {
+    const char* jsonPath = nullptr;
+    const char* filter = nullptr;
+
+    // bench [--json FILE] [GROUP], GROUP is matched against the start of the group names below
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            jsonPath = argv[++i];
+        } else {
+            filter = argv[i];
+        }
+    }
+
+    auto run = [filter](const char* group) {
+        return filter == nullptr || std::strncmp(group, filter, std::strlen(filter)) == 0;
+    };
+
+    std::mt19937 rng(42);
+
+    if (run("matmul")) {
+        benchMatMul<4>(rng, 1000000);
+        benchMatMul<16>(rng, 100000);
+        benchMatMul<64>(rng, 2000);
+        benchMatMul<128>(rng, 200);
+        benchMatMul<256>(rng, 20);
+        benchMatMul<512>(rng, 3);
+    }
+
+    if (run("lu")) {
+        benchInverse<2>(rng, 1000000);
+        benchInverse<3>(rng, 1000000);
+        benchInverse<4>(rng, 1000000);
+        benchInverse<5>(rng, 100000);
+        benchInverse<6>(rng, 100000);
+        benchInverse<7>(rng, 100000);
+        benchInverse<8>(rng, 100000);
+        benchInverse<16>(rng, 10000);
+        benchInverse<64>(rng, 100);
+        benchRigidInverse(1000000);
+    }
+
+    // inline kernels / library, only built with LINALG_BLAS and a CBLAS/LAPACK to link
+    if (run("blas") && la::Blas::ENABLED) {
+        benchBlas<64>(rng, 200);
+        benchBlas<128>(rng, 50);
+        benchBlas<256>(rng, 10);
+        benchBlas<512>(rng, 3);
+    }
+
+    if (run("vec3")) {
+        benchVec3Math(rng, 10000);
+        benchVec3Layout(rng, 20);
+    }
+
+    if (run("quat")) {
+        benchQuaternion(rng, 10000);
+    }
+
+    if (run("affine")) {
+        benchAffine(rng, 10000);
+    }
+
+    if (run("mat4")) {
+        benchMat4Vec4(rng, 10000);
+    }
+
+    if (run("expr")) {
+        benchFusedExpression(rng, 200);
+    }
+
+    if (run("vector")) {
+        std::printf("simd   packet width %zu floats\n", la::Simd::WIDTH);
+        benchVectorKernels<3>(rng, 10000000);
+        benchVectorKernels<4>(rng, 10000000);
+        benchVectorKernels<16>(rng, 10000000);
+        benchVectorKernels<256>(rng, 1000000);
+        benchVectorKernels<4096>(rng, 100000);
+    }
+
+    if (run("batch")) {
+        benchVec3Batch(rng, 20);
+    }
+
+    if (run("transform")) {
+        benchTransform(rng, 10);
+    }
+
+    if (run("dynamic")) {
+        benchDynamicTemporaries(2000);
+    }
+
+    if (run("permute")) {
+        benchPermute<0, 1>(rng, 5);
+        benchPermute<0, 2>(rng, 5);
+        benchPermute<1, 2>(rng, 5);
+    }
+
+    if (run("transpose")) {
+        benchTranspose<4>(rng, 1000000);
+        benchTranspose<64>(rng, 10000);
+        benchTranspose<1024>(rng, 20);
+    }
+
+    if (run("contract")) {
+        benchContraction(rng, 10);
+    }
+
+    if (run("parallel")) {
+        benchParallel(rng, 10);
+    }
+
+    if (run("reduce")) {
+        benchReduction(rng, 20);
+    }
+
+    if (run("format")) {
+        benchFormat(rng, 10);
+    }
+
+    if (run("io")) {
+        benchTensorFile(rng, 10);
+    }
+
+    if (run("solver")) {
+        benchSolverDense(20);
+        benchSolvers(128, 3);
+        benchSolvers(256, 1);
+    }
+
+    if (run("sparse")) {
+        benchSparse(rng, 1024, 2, 20);
+        benchSparse(rng, 100, 3, 20);
+    }
+
+    if (jsonPath != nullptr) {
+        std::FILE* out = std::fopen(jsonPath, "w");
+        if (out == nullptr) {
+            std::perror(jsonPath);
+            return 1;
+        }
+        writeJson(out);
+        std::fclose(out);
+    }
+
+    return 0;
+}
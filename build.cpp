@@ -1,5 +1,8 @@
 #include <cbuild/cbuild.hpp>
 
+#include <chrono>
+#include <cstdio>
+
 int build(CBuild::Context context) {
     
     CBuild::Executable test (
@@ -10,6 +13,15 @@ int build(CBuild::Context context) {
 
     test.includeDirectory("include");
     test.compile();
+
+    CBuild::Executable bench (
+        context,
+        "./bench.cpp",
+        "bench"
+    );
+
+    bench.includeDirectory("include");
+    bench.compile();
     
     return 0;
 }
@@ -17,4 +29,35 @@ int build(CBuild::Context context) {
 CBUILD_RUN int test() {
     
     return system("./build/test");
-}
\ No newline at end of file
+}
+
+// results are also written to build/bench.json, keep it to compare against later versions
+CBUILD_RUN int bench() {
+    
+    return system("./build/bench --json build/bench.json");
+}
+
+// the test and the benchmarks again with Matrix routed to OpenBLAS above Blas::BLAS_THRESHOLD rows,
+// swap -lopenblas for another CBLAS/LAPACK (e.g. -lcblas -llapack) if that is what is installed
+CBUILD_RUN int test_blas() {
+
+    int status = system("c++ -std=c++20 -O2 -DLINALG_BLAS -Iinclude ./test.cpp -o build/test_blas -lopenblas");
+    return status != 0 ? status : system("./build/test_blas");
+}
+
+CBUILD_RUN int bench_blas() {
+
+    int status = system("c++ -std=c++20 -O2 -march=native -DLINALG_BLAS -Iinclude ./bench.cpp -o build/bench_blas -lopenblas");
+    return status != 0 ? status : system("./build/bench_blas blas");
+}
+
+// time to compile a translation unit heavy on rank 5 and 6 shapes, compare it between versions
+CBUILD_RUN int compile_bench() {
+
+    auto start = std::chrono::steady_clock::now();
+    int status = system("c++ -std=c++20 -fsyntax-only -Iinclude ./compile_bench.cpp");
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::printf("compile_bench.cpp: %.2f s\n", elapsed.count());
+    return status;
+}
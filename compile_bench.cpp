@@ -0,0 +1,62 @@
+/**
+ * @file compile_bench.cpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Translation unit that stresses the shape metaprogramming
+ *
+ * Not meant to be run, only compiled: the compile_bench target in
+ * build.cpp times how long it takes. Every rank 5 and rank 6 shape below is permuted
+ * along each pair of dimensions, then permuted again, so the NumList
+ * helpers in varargs.hpp and the recursive TensorT definition are
+ * instantiated for a few thousand shapes. Only types are computed,
+ * no tensor code is generated.
+ */
+
+#include <linalg/linalg.hpp>
+
+#include <cstddef>
+#include <utility>
+
+namespace {
+
+    template <typename Tensor, int A, int B>
+    using Permuted = typename decltype(std::declval<const Tensor&>().template __permute<A, B>())::value_type;
+
+    // the shape permuted along A and B, then along the next pair of dimensions
+    template <typename Tensor, int A, int B>
+    constexpr std::size_t permuted() {
+        constexpr int rank = Linalg::TensorExtent<Tensor>::rank;
+        typedef Permuted<Permuted<Tensor, A, B>, (A + 1) % rank, (B + 1) % rank> Twice;
+        typedef std::remove_cvref_t<decltype(std::declval<Twice&>()[0])> Row;
+
+        return sizeof(Twice) + sizeof(Row);
+    }
+
+    template <typename Tensor, int... A, int... B>
+    constexpr std::size_t permuteAll(std::integer_sequence<int, A...>, std::integer_sequence<int, B...>) {
+        return (permuted<Tensor, A, B>() + ...);
+    }
+
+    template <int S>
+    constexpr std::size_t shapes() {
+        typedef std::integer_sequence<int, 0, 0, 0, 0, 1, 1, 1, 2, 2, 3> first5;
+        typedef std::integer_sequence<int, 1, 2, 3, 4, 2, 3, 4, 3, 4, 4> second5;
+        typedef std::integer_sequence<int, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 3, 3, 4> first6;
+        typedef std::integer_sequence<int, 1, 2, 3, 4, 5, 2, 3, 4, 5, 3, 4, 5, 4, 5, 5> second6;
+
+        return permuteAll<Linalg::Tensor<2, 3, S, 2, 3>>(first5{}, second5{})
+            + permuteAll<Linalg::Tensor<S, 2, 3, 4, 2>>(first5{}, second5{})
+            + permuteAll<Linalg::Tensor<2, S, 3, 2, 3, 2>>(first6{}, second6{})
+            + permuteAll<Linalg::Tensor<3, 2, 2, S, 2, 3>>(first6{}, second6{});
+    }
+
+    template <int... S>
+    constexpr std::size_t all(std::integer_sequence<int, S...>) {
+        return (shapes<S + 1>() + ...);
+    }
+}
+
+int main(void) {
+    static_assert(all(std::make_integer_sequence<int, 16>{}) > 0);
+    return 0;
+}
@@ -0,0 +1,59 @@
+/**
+ * @file affine.hpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Affine transforms stored without the implicit last row
+ *
+ * Contains the Affine3 class, a 3x4 matrix [A t] standing for
+ * the Mat4 [A t; 0 0 0 1]. Dropping the constant row saves a
+ * quarter of the storage and of the flops of every product and
+ * transform. Conversions to and from Mat4 are explicit.
+ */
+
+#ifndef LINALG_AFFINE_HPP
+#define LINALG_AFFINE_HPP
+
+#include <span>
+
+#include <linalg/matrix.hpp>
+#include <linalg/vector.hpp>
+
+namespace Linalg {
+
+    class Affine3 : public Matrix<3, 4> {
+        public:
+            using Matrix<3, 4>::Matrix;
+            Affine3(Matrix<3, 4> r) : Matrix<3, 4>(r) {}
+            Affine3(const Mat3& linear, const Vec3& translation);
+
+            // the last row of the matrix is dropped, it must be [0 0 0 1]
+            explicit Affine3(const Mat4& matrix);
+            Mat4 toMat4() const;
+
+            static Affine3 identity();
+
+            Mat3 linear() const;
+            Vec3 translation() const;
+
+            // this after rhs, 36 multiplies instead of the 64 of a Mat4 product
+            Affine3 operator*(const Affine3& rhs) const;
+
+            // A p + t and A d
+            Vec3 transformPoint(const Vec3& point) const;
+            Vec3 transformDirection(const Vec3& direction) const;
+
+            // [A^-1  -A^-1 t], A is inverted in closed form
+            Affine3 inverse() const;
+
+            // [A^T  -A^T t] when A is orthonormal, which is not checked
+            Affine3 rigidInverse() const;
+    };
+
+    static_assert(sizeof(Affine3) == 12 * sizeof(float), "Affine3 must be tightly packed");
+
+    // span versions of transformPoint and transformDirection
+    void transformPoints(const Affine3& transform, std::span<const Vec3> in, std::span<Vec3> out);
+    void transformDirections(const Affine3& transform, std::span<const Vec3> in, std::span<Vec3> out);
+}
+
+#endif
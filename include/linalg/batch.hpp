@@ -0,0 +1,74 @@
+/**
+ * @file batch.hpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Structure of arrays containers for many vectors
+ *
+ * Contains the VecBatch class which stores each component
+ * of a set of vectors in its own contiguous, aligned array
+ * (x[], y[], z[] ...) so that batched operations fill whole
+ * SIMD registers instead of shuffling AoS Vectors.
+ */
+
+#ifndef LINALG_BATCH_HPP
+#define LINALG_BATCH_HPP
+
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+#include <linalg/memory.hpp>
+#include <linalg/simd.hpp>
+#include <linalg/vector.hpp>
+
+namespace Linalg {
+
+    template <int D>
+    class VecBatch {
+        public:
+            VecBatch() = default;
+            VecBatch(std::size_t count);
+
+            template <typename V>
+            VecBatch(std::span<const V> points);
+
+            // AoS <-> SoA, V is Vector<D> or one of its named aliases
+            template <typename V>
+            void load(std::span<const V> points);
+            template <typename V>
+            void store(std::span<V> points) const;
+
+            std::size_t size() const;
+            void resize(std::size_t count);
+
+            float* component(int index);
+            const float* component(int index) const;
+
+            Vector<D> operator[](std::size_t index) const;
+            void set(std::size_t index, const Vector<D>& value);
+
+            // other must hold as many vectors and out at least as many floats, or
+            // std::invalid_argument is thrown. Batch outputs are resized to fit
+            void dot(const VecBatch& other, std::span<float> out) const;
+            void squaredLength(std::span<float> out) const;
+            void length(std::span<float> out) const;
+
+            void cross(const VecBatch& other, VecBatch& out) const;
+            void lerp(const VecBatch& to, float t, VecBatch& out) const;
+            void normalize(VecBatch& out) const;
+            VecBatch& normalize();
+
+        protected:
+            // component c of vector i lives at data[c * stride + i], stride
+            // is count rounded up to a whole packet so every array is aligned
+            AlignedVector<float> data;
+            std::size_t count = 0;
+            std::size_t stride = 0;
+    };
+
+    using Vec2Batch = VecBatch<2>;
+    using Vec3Batch = VecBatch<3>;
+    using Vec4Batch = VecBatch<4>;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,66 @@
+/**
+ * @file blas.hpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Optional BLAS/LAPACK backend for large matrices
+ *
+ * Define LINALG_BLAS and link a CBLAS and LAPACK implementation
+ * (e.g. -lopenblas) to route Matrix products, solves, inverses
+ * and determinants of float and double matrices with at least
+ * BLAS_THRESHOLD rows to the library. Smaller matrices, other
+ * scalars and constant evaluation keep the inline kernels.
+ *
+ * LAPACK is called through its Fortran symbols, which every
+ * implementation exports, rather than through LAPACKE. LAPACK
+ * is column-major, so a row-major matrix is seen transposed.
+ */
+
+#ifndef LINALG_BLAS_HPP
+#define LINALG_BLAS_HPP
+
+#include <type_traits>
+
+namespace Linalg::Blas {
+
+    // below 32 rows the call overhead is larger than what the library gains
+    constexpr int BLAS_THRESHOLD = 32;
+
+#ifdef LINALG_BLAS
+    constexpr bool ENABLED = true;
+#else
+    constexpr bool ENABLED = false;
+#endif
+
+    // whether a T matrix whose smallest dimension is N goes to the library
+    template <int N, typename T>
+    constexpr bool routed = ENABLED && N >= BLAS_THRESHOLD &&
+        (std::is_same_v<T, float> || std::is_same_v<T, double>);
+
+    // the kernels below are only defined when LINALG_BLAS is, and only called when routed is true
+
+    // C (n x m) = A (n x k) * B (k x m), all row-major
+    template <typename T>
+    void gemm(int n, int k, int m, const T* a, const T* b, T* c);
+
+    // y (n) = A (n x m) * x (m), A row-major
+    template <typename T>
+    void gemv(int n, int m, const T* a, const T* x, T* y);
+
+    // LU factorization of the n x n row-major a in place, returns false if a is singular
+    template <typename T>
+    bool getrf(int n, T* a, int* pivots);
+
+    // solves A x = b with the factors of getrf, b is overwritten with x
+    template <typename T>
+    void getrs(int n, const T* factors, const int* pivots, T* b);
+
+    // replaces the factors of getrf with the inverse of A
+    template <typename T>
+    void getri(int n, T* factors, const int* pivots);
+
+    // determinant from the factors of getrf
+    template <typename T>
+    T determinant(int n, const T* factors, const int* pivots);
+}
+
+#endif
@@ -0,0 +1,81 @@
+/**
+ * @file contraction.hpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Einsum style contraction of two tensors
+ *
+ * Each dimension of both operands and of the result is named
+ * by a label, in the order of the tensor's dimensions. Labels
+ * found in both operands but not in the result are summed
+ * over, labels found in both and in the result are batched.
+ * Labels and sizes are checked at compile time, then the
+ * operands are packed so that the contraction is one blocked
+ * gemm per batch.
+ *
+ *     // C_ij = A_ik B_kj, Matrix<N, V> is a Tensor<V, N>
+ *     Tensor<M, N> c = contract<Labels<'k', 'i'>, Labels<'j', 'k'>, Labels<'j', 'i'>>(a, b);
+ */
+
+#ifndef LINALG_CONTRACTION_HPP
+#define LINALG_CONTRACTION_HPP
+
+#include <type_traits>
+
+#include <linalg/gemm.hpp>
+#include <linalg/tensor.hpp>
+#include <linalg/varargs.hpp>
+#include <linalg/vector.hpp>
+
+namespace Linalg {
+
+    template <char... L>
+    using Labels = NumList<L...>;
+
+    // splits the labels of a contraction, LA/LB/LO are labels and DA/DB the dimensions of the operands
+    template <typename LA, typename LB, typename LO, typename DA, typename DB>
+    struct Contraction {
+        static_assert(int(GetSize<LA>::value) == int(GetSize<DA>::value), "One label per dimension of the first operand");
+        static_assert(int(GetSize<LB>::value) == int(GetSize<DB>::value), "One label per dimension of the second operand");
+        static_assert(IsUnique<LA>::value && IsUnique<LB>::value && IsUnique<LO>::value,
+            "A label can only name one dimension of a tensor");
+
+        typedef typename ConcatList<LA, LB>::value labels;
+        typedef typename ConcatList<DA, DB>::value dims;
+
+        static_assert(std::is_same_v<Difference<LO, labels>, NumList<>>, "Result labels must come from an operand");
+        static_assert(std::is_same_v<Difference<Difference<LA, LO>, LB>, NumList<>> &&
+            std::is_same_v<Difference<Difference<LB, LO>, LA>, NumList<>>,
+            "Summed labels must appear in both operands");
+
+        typedef Intersect<LA, LB> shared;
+        static_assert(std::is_same_v<typename Gather<DA, LA, shared>::value, typename Gather<DB, LB, shared>::value>,
+            "Dimensions with the same label must have the same size");
+
+        typedef Intersect<shared, LO> batch;
+        typedef Difference<shared, LO> summed;
+        typedef Difference<LA, LB> freeA;
+        typedef Difference<LB, LA> freeB;
+
+        // A as (summed, freeA, batch) is a row-major freeA x summed matrix per batch,
+        // B as (freeB, summed, batch) is summed x freeB and C as (freeB, freeA, batch) is freeA x freeB
+        typedef typename ConcatList<typename ConcatList<summed, freeA>::value, batch>::value packedA;
+        typedef typename ConcatList<typename ConcatList<freeB, summed>::value, batch>::value packedB;
+        typedef typename ConcatList<typename ConcatList<freeB, freeA>::value, batch>::value packedC;
+
+        static constexpr int N = Product<typename Gather<dims, labels, freeA>::value>::value;
+        static constexpr int K = Product<typename Gather<dims, labels, summed>::value>::value;
+        static constexpr int M = Product<typename Gather<dims, labels, freeB>::value>::value;
+        static constexpr int BATCH = Product<typename Gather<dims, labels, batch>::value>::value;
+
+        // a scalar when every label is summed
+        template <typename T>
+        using result = std::conditional_t<GetSize<LO>::value == 0, T,
+            TensorT<typename Gather<dims, labels, LO>::value, T>>;
+    };
+
+    template <typename LA, typename LB, typename LO, int... DA, int... DB, typename T>
+    typename Contraction<LA, LB, LO, NumList<DA...>, NumList<DB...>>::template result<T>
+    contract(const TensorT<NumList<DA...>, T>& a, const TensorT<NumList<DB...>, T>& b);
+}
+
+#endif
@@ -0,0 +1,120 @@
+/**
+ * @file dynamic_tensor.hpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Tensor with a shape chosen at runtime
+ *
+ * Contains the DynamicTensor class, which keeps its elements
+ * in one contiguous, cache line aligned heap buffer. Memory
+ * comes from a std::pmr::memory_resource, so short lived
+ * temporaries can be taken from an Arena or a Pool. A fixed
+ * size TensorT can be viewed as a DynamicTensor without a copy.
+ */
+
+#ifndef LINALG_DYNAMIC_TENSOR_HPP
+#define LINALG_DYNAMIC_TENSOR_HPP
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+#include <linalg/expression.hpp>
+#include <linalg/memory.hpp>
+#include <linalg/tensor.hpp>
+
+namespace Linalg {
+
+    // bump allocator, everything is released at once when it is destroyed or released
+    using Arena = std::pmr::monotonic_buffer_resource;
+
+    // recycles blocks of the same size class, for temporaries of repeating shapes
+    using Pool = std::pmr::unsynchronized_pool_resource;
+
+    class DynamicTensor {
+        public:
+            DynamicTensor() = default;
+            DynamicTensor(std::vector<std::size_t> shape,
+                std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+            DynamicTensor(std::vector<std::size_t> shape, float value,
+                std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+            // copies a fixed size tensor to the heap
+            template <int... D>
+            DynamicTensor(const TensorT<NumList<D...>>& tensor,
+                std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+            // shares the storage of a fixed size tensor, which must outlive the view
+            template <int... D>
+            static DynamicTensor view(TensorT<NumList<D...>>& tensor);
+            static DynamicTensor view(float* data, std::vector<std::size_t> shape);
+
+            DynamicTensor(const DynamicTensor& other);
+            DynamicTensor(const DynamicTensor& other, std::pmr::memory_resource* resource);
+            DynamicTensor(DynamicTensor&& other) noexcept;
+            DynamicTensor& operator=(const DynamicTensor& other);
+            DynamicTensor& operator=(DynamicTensor&& other) noexcept;
+            ~DynamicTensor();
+
+            std::size_t size() const;
+            std::size_t rank() const;
+            const std::vector<std::size_t>& shape() const;
+            bool owning() const;
+
+            float* data();
+            const float* data() const;
+            std::span<float> span();
+            std::span<const float> span() const;
+
+            // indices in shape order, the first index varies fastest like TensorT
+            float& at(std::initializer_list<std::size_t> indices);
+            const float& at(std::initializer_list<std::size_t> indices) const;
+
+            // reinterprets the buffer as a fixed size tensor of the same shape. Throws for a
+            // view that ends before the padding of a tensor of a cache line or more
+            template <int... D>
+            TensorT<NumList<D...>>& as();
+
+            void fill(float value);
+            void reshape(std::vector<std::size_t> shape);
+
+            // results are allocated from the left operand's resource
+            DynamicTensor operator+(const DynamicTensor& rhs) const;
+            DynamicTensor operator-(const DynamicTensor& rhs) const;
+            DynamicTensor operator*(const DynamicTensor& rhs) const;
+            DynamicTensor operator/(const DynamicTensor& rhs) const;
+
+            DynamicTensor operator+(float rhs) const;
+            DynamicTensor operator-(float rhs) const;
+            DynamicTensor operator*(float rhs) const;
+            DynamicTensor operator/(float rhs) const;
+
+            DynamicTensor& operator+=(const DynamicTensor& rhs);
+            DynamicTensor& operator-=(const DynamicTensor& rhs);
+            DynamicTensor& operator*=(const DynamicTensor& rhs);
+            DynamicTensor& operator/=(const DynamicTensor& rhs);
+
+            DynamicTensor& operator+=(float rhs);
+            DynamicTensor& operator-=(float rhs);
+            DynamicTensor& operator*=(float rhs);
+            DynamicTensor& operator/=(float rhs);
+
+        protected:
+            void allocate(std::size_t count);
+            void release();
+            void checkShape(const DynamicTensor& other) const;
+
+            template <typename Op>
+            void apply(const float* rhs, float* out) const;
+            template <typename Op>
+            void apply(float rhs, float* out) const;
+
+            std::vector<std::size_t> dims;
+            float* elements = nullptr;
+            std::size_t count = 0;
+            std::pmr::memory_resource* resource = nullptr;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,60 @@
+/**
+ * @file execution.hpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Execution policies for large tensor operations
+ *
+ * Operators always run on the calling thread. Passing par to
+ * assign, sum or dot splits the work over a ThreadPool, but
+ * only for tensors of at least PARALLEL_THRESHOLD elements.
+ * The size is known at compile time, so smaller tensors take
+ * the serial path with no runtime check at all.
+ *
+ *     la::assign(la::par, out, a * 2 + b);
+ *     la::assign(la::par, outT, t.permute(0, 2));
+ *     float total = la::sum(la::par, t);
+ */
+
+#ifndef LINALG_EXECUTION_HPP
+#define LINALG_EXECUTION_HPP
+
+#include <cstddef>
+
+#include <linalg/expression.hpp>
+#include <linalg/tensor.hpp>
+#include <linalg/thread_pool.hpp>
+#include <linalg/view.hpp>
+
+namespace Linalg {
+
+    // tensors with fewer elements than this are never split, 256 KiB of floats
+    constexpr std::size_t PARALLEL_THRESHOLD = 1 << 16;
+
+    struct Sequenced {};
+
+    struct Parallel {
+        ThreadPool* pool = nullptr;
+
+        // the same policy on a pool other than ThreadPool::instance()
+        constexpr Parallel on(ThreadPool& other) const { return {&other}; }
+        ThreadPool& threads() const { return pool ? *pool : ThreadPool::instance(); }
+    };
+
+    inline constexpr Sequenced seq;
+    inline constexpr Parallel par;
+
+    // out = expression, split over the outermost dimension of out
+    template <typename Policy, int... D, typename T, typename E>
+    void assign(const Policy& policy, TensorT<NumList<D...>, T>& out, const E& expression);
+
+    // reductions over every element, the partial sums are added in a fixed order
+    // so a result does not depend on the number of threads. They add up and return
+    // Accumulator<T>, int for the narrow integers and float for Half and BFloat16
+    template <typename Policy, int... D, typename T>
+    Accumulator<T> sum(const Policy& policy, const TensorT<NumList<D...>, T>& tensor);
+
+    template <typename Policy, int... D, typename T>
+    Accumulator<T> dot(const Policy& policy, const TensorT<NumList<D...>, T>& a, const TensorT<NumList<D...>, T>& b);
+}
+
+#endif
@@ -0,0 +1,334 @@
+/**
+ * @file expression.hpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Lazy expression templates for TensorT arithmetic
+ *
+ * Arithmetic on tensors builds a BinaryExpression tree
+ * instead of a new TensorT. The tree is only evaluated,
+ * in a single pass, when it is assigned to a TensorT.
+ * Expressions hold references to their tensor operands,
+ * so they should not outlive the statement they are in.
+ */
+
+#ifndef LINALG_EXPRESSION_HPP
+#define LINALG_EXPRESSION_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <linalg/scalar.hpp>
+#include <linalg/simd.hpp>
+#include <linalg/varargs.hpp>
+
+namespace Linalg {
+
+    template <typename, typename>
+    class TensorT;
+
+    struct ExpressionBase {};
+
+    struct AddOp {
+        template <typename A, typename B>
+        static constexpr auto apply(A a, B b) { return a + b; }
+        static Simd::Packet apply(Simd::Packet a, Simd::Packet b) { return Simd::add(a, b); }
+    };
+
+    struct SubOp {
+        template <typename A, typename B>
+        static constexpr auto apply(A a, B b) { return a - b; }
+        static Simd::Packet apply(Simd::Packet a, Simd::Packet b) { return Simd::sub(a, b); }
+    };
+
+    struct MulOp {
+        template <typename A, typename B>
+        static constexpr auto apply(A a, B b) { return a * b; }
+        static Simd::Packet apply(Simd::Packet a, Simd::Packet b) { return Simd::mul(a, b); }
+    };
+
+    struct DivOp {
+        template <typename A, typename B>
+        static constexpr auto apply(A a, B b) { return a / b; }
+        static Simd::Packet apply(Simd::Packet a, Simd::Packet b) { return Simd::div(a, b); }
+    };
+
+    template <typename List, typename T>
+    TensorT<List, T> tensorBase(const TensorT<List, T>*);
+    void tensorBase(...);
+
+    // the TensorT a type derives from, void for non tensors
+    template <typename T>
+    using TensorBase = decltype(tensorBase(std::declval<const T*>()));
+
+    template <typename T>
+    struct IsTensor {
+        static constexpr bool value = !std::is_void_v<TensorBase<T>>;
+    };
+
+    template <typename T>
+    struct IsExpression {
+        static constexpr bool value = std::is_base_of_v<ExpressionBase, T>;
+    };
+
+    // how an operand is held inside an expression
+    template <typename T, typename = void>
+    struct Operand;
+
+    template <typename T>
+    struct Operand<T, std::enable_if_t<IsScalar<T>::value>> {
+        typedef T type;
+        typedef void value;
+    };
+
+    template <typename T>
+    struct Operand<T, std::enable_if_t<IsExpression<T>::value>> {
+        typedef T type;
+        typedef typename T::value_type value;
+    };
+
+    template <typename T>
+    struct Operand<T, std::enable_if_t<IsTensor<T>::value && !IsExpression<T>::value>> {
+        typedef const TensorBase<T>& type;
+        typedef TensorBase<T> value;
+    };
+
+    template <typename L, typename R, typename = void>
+    struct IsCompatible {
+        static constexpr bool value = false;
+    };
+
+    template <typename L, typename R>
+    struct IsCompatible<L, R, std::void_t<typename Operand<L>::value, typename Operand<R>::value>> {
+        typedef typename Operand<L>::value left;
+        typedef typename Operand<R>::value right;
+
+        static constexpr bool value = !(std::is_void_v<left> && std::is_void_v<right>) &&
+            (std::is_void_v<left> || std::is_void_v<right> || std::is_same_v<left, right>);
+
+        typedef std::conditional_t<std::is_void_v<left>, right, left> result;
+    };
+
+    template <typename L, typename R>
+    using EnableExpression = std::enable_if_t<IsCompatible<L, R>::value, int>;
+
+    // operands accepted by the compound operators of tensor T
+    template <typename E, typename T>
+    using EnableCompound = std::enable_if_t<
+        IsScalar<E>::value || std::is_same_v<typename IsCompatible<E, T>::result, T>, int>;
+
+    template <typename>
+    struct TensorExtent;
+
+    template <int... D, typename T>
+    struct TensorExtent<TensorT<NumList<D...>, T>> {
+        enum {value = ITEMS<D...>[sizeof...(D) - 1]};
+        enum {rank = sizeof...(D)};
+        typedef T scalar;
+    };
+
+    // scalars are converted to the element type of the tensor they are combined with
+    template <typename T, typename Other>
+    using Hold = std::conditional_t<IsScalar<T>::value,
+        typename TensorExtent<typename IsCompatible<T, Other>::result>::scalar,
+        typename Operand<T>::type>;
+
+    template <typename T>
+    constexpr decltype(auto) elementAt(const T& operand, std::size_t index) {
+        if constexpr (IsScalar<T>::value) {
+            return operand;
+        } else {
+            return operand[index];
+        }
+    }
+
+    // WIDTH consecutive elements of a rank 1 float operand starting at index
+    template <typename T>
+    Simd::Packet packetAt(const T& operand, std::size_t index) {
+        if constexpr (IsScalar<T>::value) {
+            return Simd::broadcast(static_cast<float>(operand));
+        } else if constexpr (IsExpression<T>::value) {
+            return operand.packet(index);
+        } else {
+            return Simd::load(&operand[index]);
+        }
+    }
+
+    template <typename Op, typename L, typename R>
+    class BinaryExpression;
+
+    // whether an operand can be read at an index over all of its dimensions at once,
+    // which holds for tensors and scalars but not for strided views
+    template <typename T>
+    struct IsFlat {
+        static constexpr bool value = !IsExpression<T>::value;
+    };
+
+    template <typename Op, typename L, typename R>
+    struct IsFlat<BinaryExpression<Op, L, R>> {
+        static constexpr bool value = IsFlat<std::decay_t<L>>::value && IsFlat<std::decay_t<R>>::value;
+    };
+
+    template <typename T>
+    constexpr auto flatAt(const T& operand, std::size_t index) {
+        if constexpr (IsScalar<T>::value) {
+            return operand;
+        } else if constexpr (IsExpression<T>::value) {
+            return operand.flat(index);
+        } else {
+            return operand.data()[index];
+        }
+    }
+
+    template <typename T>
+    Simd::Packet flatPacketAt(const T& operand, std::size_t index) {
+        if constexpr (IsScalar<T>::value) {
+            return Simd::broadcast(static_cast<float>(operand));
+        } else if constexpr (IsExpression<T>::value) {
+            return operand.flatPacket(index);
+        } else {
+            return Simd::load(operand.data() + index);
+        }
+    }
+
+    // whether an operand reads storage that writing out one index at a time overwrites
+    // first. Scalars never do, tensors only when out is a view of one
+    template <typename T, typename Out>
+    constexpr bool operandAliases(const T& operand, const Out& out) {
+        if constexpr (IsExpression<T>::value) {
+            return operand.aliases(out);
+        } else if constexpr (IsTensor<T>::value && IsExpression<Out>::value) {
+            return out.aliases(operand);
+        } else {
+            return false;
+        }
+    }
+
+    template <typename Op, typename L, typename R>
+    class BinaryExpression : public ExpressionBase {
+        public:
+            typedef typename IsCompatible<std::decay_t<L>, std::decay_t<R>>::result value_type;
+
+            constexpr BinaryExpression(L lhs, R rhs) : lhs(lhs), rhs(rhs) {}
+
+            constexpr auto operator[](std::size_t index) const {
+                if constexpr (TensorExtent<value_type>::rank == 1) {
+                    return Op::apply(elementAt(lhs, index), elementAt(rhs, index));
+                } else {
+                    return makeExpression(elementAt(lhs, index), elementAt(rhs, index));
+                }
+            }
+
+            Simd::Packet packet(std::size_t index) const {
+                return Op::apply(packetAt(lhs, index), packetAt(rhs, index));
+            }
+
+            // element and packet at an index over all dimensions, for flat expressions
+            auto flat(std::size_t index) const {
+                return Op::apply(flatAt(lhs, index), flatAt(rhs, index));
+            }
+
+            Simd::Packet flatPacket(std::size_t index) const {
+                return Op::apply(flatPacketAt(lhs, index), flatPacketAt(rhs, index));
+            }
+
+            static constexpr std::size_t size() { return TensorExtent<value_type>::value; }
+
+            constexpr value_type eval() const { return value_type(*this); }
+
+            // whether any view in the tree aliases out, see StridedView::aliases
+            template <typename Out>
+            constexpr bool aliases(const Out& out) const {
+                return operandAliases(lhs, out) || operandAliases(rhs, out);
+            }
+
+        private:
+            template <typename A, typename B>
+            static constexpr BinaryExpression<Op, typename Operand<A>::type, typename Operand<B>::type>
+            makeExpression(const A& a, const B& b) { return {a, b}; }
+
+            L lhs;
+            R rhs;
+    };
+
+    // writes a rank 1 expression to out, a packet at a time for float tensors
+    // and an element at a time in constant expressions
+    template <typename T, typename E>
+    constexpr void evaluate(T* out, const E& expression) {
+        constexpr std::size_t n = E::size();
+        constexpr std::size_t packed = std::is_same_v<T, float> ? n - n % Simd::WIDTH : 0;
+
+        if (std::is_constant_evaluated()) {
+            for (std::size_t i = 0; i < n; i++) {
+                out[i] = static_cast<T>(expression[i]);
+            }
+            return;
+        }
+
+        if constexpr (packed > 0) {
+            for (std::size_t i = 0; i < packed; i += Simd::WIDTH) {
+                Simd::store(out + i, expression.packet(i));
+            }
+        }
+
+        for (std::size_t i = packed; i < n; i++) {
+            out[i] = static_cast<T>(expression[i]);
+        }
+    }
+
+    // writes an expression of any rank to the contiguous out one row at a time, for
+    // expressions that read strided views and in constant expressions
+    template <typename T, typename E>
+    constexpr void evaluateRows(T* out, const E& expression) {
+        typedef typename E::value_type Result;
+
+        if constexpr (TensorExtent<Result>::rank == 1) {
+            evaluate(out, expression);
+        } else {
+            constexpr std::size_t rows = TensorExtent<Result>::value;
+            constexpr std::size_t inner = Result::count / rows;
+
+            for (std::size_t i = 0; i < rows; i++) {
+                evaluateRows(out + i * inner, expression[i]);
+            }
+        }
+    }
+
+    // writes elements [first, last) of a flat expression of any rank to out,
+    // indexed over all dimensions at once so that short rows are not a loop each
+    template <typename T, typename E>
+    void evaluateFlat(T* out, const E& expression, std::size_t first, std::size_t last) {
+        static_assert(IsFlat<E>::value, "Strided views cannot be read as one buffer");
+
+        std::size_t packed = first;
+
+        if constexpr (std::is_same_v<T, float>) {
+            packed = last - (last - first) % Simd::WIDTH;
+            for (std::size_t i = first; i < packed; i += Simd::WIDTH) {
+                Simd::store(out + i, expression.flatPacket(i));
+            }
+        }
+
+        for (std::size_t i = packed; i < last; i++) {
+            out[i] = static_cast<T>(expression.flat(i));
+        }
+    }
+
+    // writes elements [first, last) of a rank 1 expression to out
+    template <typename T, typename E>
+    void evaluate(T* out, const E& expression, std::size_t first, std::size_t last) {
+        std::size_t i = first;
+
+        if constexpr (std::is_same_v<T, float>) {
+            for (; i + Simd::WIDTH <= last; i += Simd::WIDTH) {
+                Simd::store(out + i, expression.packet(i));
+            }
+        }
+
+        for (; i < last; i++) {
+            out[i] = static_cast<T>(expression[i]);
+        }
+    }
+}
+
+#endif
\ No newline at end of file
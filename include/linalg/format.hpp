@@ -0,0 +1,55 @@
+/**
+ * @file format.hpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Text formatting and parsing of tensors of any rank
+ *
+ * Elements are written with std::to_chars into a caller's buffer
+ * or through a small stack buffer into a stream, so nothing is
+ * allocated per element. Each dimension is a group, dimension 0
+ * innermost, so a Tensor<3, 2> prints as ((a, b, c), (d, e, f))
+ * and a Matrix one row per inner group. Without brackets, groups
+ * of dimension 0 are separated by newlines, which is CSV for a
+ * Matrix. parse reads either layout back.
+ */
+
+#ifndef LINALG_FORMAT_HPP
+#define LINALG_FORMAT_HPP
+
+#include <charconv>
+#include <ostream>
+#include <string>
+
+#include <linalg/tensor.hpp>
+
+namespace Linalg {
+
+    // precision for the shortest string that parses back to the same value
+    constexpr int SHORTEST = -1;
+
+    struct FormatOptions {
+        // digits after the point for floating point elements, or SHORTEST
+        int precision = 6;
+        bool brackets = true;
+        const char* separator = ", ";
+    };
+
+    // writes into [first, last), returns errc::value_too_large if it does not fit
+    template <int... D, typename T>
+    std::to_chars_result format(char* first, char* last, const TensorT<NumList<D...>, T>& tensor,
+        const FormatOptions& options = {});
+
+    template <int... D, typename T>
+    void format(std::ostream& stream, const TensorT<NumList<D...>, T>& tensor, const FormatOptions& options = {});
+
+    template <int... D, typename T>
+    std::string toString(const TensorT<NumList<D...>, T>& tensor, const FormatOptions& options = {});
+
+    // reads size() numbers in storage order, brackets, commas, semicolons and
+    // whitespace between them are skipped. errc::invalid_argument if there are too few,
+    // errc::result_out_of_range if one does not fit T
+    template <int... D, typename T>
+    std::from_chars_result parse(const char* first, const char* last, TensorT<NumList<D...>, T>& tensor);
+}
+
+#endif
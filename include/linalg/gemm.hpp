@@ -0,0 +1,38 @@
+/**
+ * @file gemm.hpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief General matrix-matrix multiplication kernels
+ *
+ * Contains the cache blocked, register tiled kernel used
+ * by Matrix multiplication. Matrices are passed as raw
+ * row-major buffers with compile time sizes.
+ */
+
+#ifndef LINALG_GEMM_HPP
+#define LINALG_GEMM_HPP
+
+#include <cstddef>
+
+namespace Linalg::Kernels {
+
+    // register tile, MR rows of A against NR columns of B
+    constexpr int GEMM_MR = 4;
+    constexpr int GEMM_NR = 16;
+
+    // cache blocks, a KC x NC panel of B is kept in L2 and
+    // an MC x KC panel of A in L1 while the tiles sweep it
+    constexpr int GEMM_MC = 64;
+    constexpr int GEMM_KC = 128;
+    constexpr int GEMM_NC = 512;
+
+    // C (N x M) = A (N x K) * B (K x M)
+    template <int N, int K, int M, typename T>
+    void gemm(const T* a, const T* b, T* c);
+
+    // reference triple loop, used for small sizes
+    template <int N, int K, int M, typename T>
+    void gemmNaive(const T* a, const T* b, T* c);
+}
+
+#endif
\ No newline at end of file
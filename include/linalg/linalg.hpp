@@ -14,11 +14,32 @@
 namespace Linalg {}
 namespace la = Linalg;
 
+#include <linalg/affine.hpp>
+#include <linalg/batch.hpp>
+#include <linalg/blas.hpp>
+#include <linalg/contraction.hpp>
+#include <linalg/dynamic_tensor.hpp>
+#include <linalg/execution.hpp>
+#include <linalg/format.hpp>
+#include <linalg/gemm.hpp>
+#include <linalg/lu.hpp>
 #include <linalg/matrix.hpp>
+#include <linalg/memory.hpp>
 #include <linalg/operations.hpp>
+#include <linalg/preconditioner.hpp>
+#include <linalg/quaternion.hpp>
+#include <linalg/reduction.hpp>
+#include <linalg/scalar.hpp>
+#include <linalg/simd.hpp>
+#include <linalg/solver.hpp>
+#include <linalg/sparse.hpp>
 #include <linalg/tensor.hpp>
+#include <linalg/tensor_file.hpp>
+#include <linalg/thread_pool.hpp>
+#include <linalg/transform.hpp>
 #include <linalg/varargs.hpp>
 #include <linalg/vector.hpp>
+#include <linalg/view.hpp>
 
 #include "../../src/linalg.cpp"
 
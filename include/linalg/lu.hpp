@@ -0,0 +1,45 @@
+/**
+ * @file lu.hpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief LU decomposition of square matrices
+ *
+ * Contains the LU class which factors a square Matrix
+ * with partial pivoting, P * A = L * U. The factorization
+ * can be reused to solve for many right hand sides.
+ */
+
+#ifndef LINALG_LU_HPP
+#define LINALG_LU_HPP
+
+#include <array>
+#include <stdexcept>
+#include <type_traits>
+
+#include <linalg/matrix.hpp>
+#include <linalg/vector.hpp>
+
+namespace Linalg {
+
+    template <int N, typename T = float>
+    class LU {
+        static_assert(std::is_floating_point_v<T>, "LU decomposition needs a floating point scalar");
+
+        public:
+            constexpr LU(const Matrix<N, N, T>& matrix);
+
+            constexpr bool singular() const;
+            constexpr T determinant() const;
+            constexpr Vector<N, T> solve(const Vector<N, T>& b) const;
+            constexpr Matrix<N, N, T> inverse() const;
+
+        protected:
+            // L below the diagonal (unit diagonal implied), U on and above it
+            Matrix<N, N, T> factors;
+            std::array<int, N> pivots;
+            int sign = 1;
+            bool isSingular = false;
+    };
+}
+
+#endif
\ No newline at end of file
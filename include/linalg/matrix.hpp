@@ -11,29 +11,55 @@
 #ifndef LINALG_MATRIX_HPP
 #define LINALG_MATRIX_HPP
 
+#include <linalg/gemm.hpp>
 #include <linalg/tensor.hpp>
 #include <linalg/vector.hpp>
 
 namespace Linalg {
 
-    template <int N, int V> 
-    class Matrix : public Tensor<N, V> {
+    template <int N, typename T>
+    class LU;
+
+    // N rows of V columns, stored row-major. operator[] returns a row as a
+    // StridedView that writes through to the matrix, assign it to a Vector<V, T> to copy it
+    template <int N, int V, typename T = float> 
+    class Matrix : public TensorT<NumList<V, N>, T> {
+        template <int, int, typename>
+        friend class Matrix;
+
         public:
-            using Tensor<N, V>::TensorT;
-            Matrix(Tensor<N, V> r) : Tensor<N, V>(r) {}
-            Matrix operator=(const Matrix& rhs) { 
-                this->data = rhs.data;
-                return *this;
-            }
+            using TensorT<NumList<V, N>, T>::TensorT;
+            using TensorT<NumList<V, N>, T>::operator=;
+            constexpr Matrix(TensorT<NumList<V, N>, T> r) : TensorT<NumList<V, N>, T>(r) {}
+            constexpr Matrix(const Matrix&) = default;
+            constexpr Matrix& operator=(const Matrix&) = default;
+
+            constexpr Matrix<V, N, T> transpose() const;
+
+            // 2x2 to 4x4 use closed-form cofactors, larger matrices an LU factorization,
+            // from LAPACK when built with LINALG_BLAS (see blas.hpp)
+            constexpr Matrix adjoint() const;
+            constexpr Matrix inverse() const;
+            constexpr T determinant() const;
+
+            // inverse of a homogeneous transform [R t; 0 1] with R orthonormal,
+            // which is not checked. A pure rotation is inverted by transpose()
+            constexpr Matrix rigidInverse() const;
+
+            constexpr LU<N, T> lu() const;
+            constexpr Vector<N, T> solve(const Vector<N, T>& b) const;
+
+            constexpr Vector<N, T> operator*(const Vector<V, T>& rhs) const;
 
-            Matrix<V, N> transpose() const;
-            Matrix adjoint() const;
-            Matrix inverse() const;
-            float determinant() const;
+            template <int K>
+            constexpr Matrix<N, K, T> operator*(const Matrix<V, K, T>& rhs) const;
 
-            Vector<N> operator*(const Vector<V>& rhs) const;
+            // *this = *this * rhs, the matrix product like operator*. Scalars and
+            // other tensors still multiply element by element
+            using TensorT<NumList<V, N>, T>::operator*=;
+            constexpr Matrix& operator*=(const Matrix<V, V, T>& rhs);
 
-            static Matrix identity();
+            static constexpr Matrix identity();
     };
 
     using Mat2 = Matrix<2, 2>;
@@ -0,0 +1,48 @@
+/**
+ * @file memory.hpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Aligned allocation for heap backed containers
+ *
+ * Contains an allocator returning memory aligned to a
+ * cache line, so SIMD kernels can use full width packets
+ * on heap buffers.
+ */
+
+#ifndef LINALG_MEMORY_HPP
+#define LINALG_MEMORY_HPP
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace Linalg {
+
+    constexpr std::size_t CACHE_LINE = 64;
+
+    template <typename T, std::size_t Align = CACHE_LINE>
+    class AlignedAllocator {
+        public:
+            typedef T value_type;
+
+            template <typename U>
+            struct rebind { typedef AlignedAllocator<U, Align> other; };
+
+            AlignedAllocator() = default;
+            template <typename U>
+            AlignedAllocator(const AlignedAllocator<U, Align>&) {}
+
+            T* allocate(std::size_t count);
+            void deallocate(T* pointer, std::size_t count);
+
+            template <typename U>
+            bool operator==(const AlignedAllocator<U, Align>&) const { return true; }
+            template <typename U>
+            bool operator!=(const AlignedAllocator<U, Align>&) const { return false; }
+    };
+
+    template <typename T>
+    using AlignedVector = std::vector<T, AlignedAllocator<T>>;
+}
+
+#endif
\ No newline at end of file
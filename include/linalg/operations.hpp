@@ -3,53 +3,62 @@
  * @author lukem
  * @date 2025-11-28
  * @brief Macro defintions for TensorT's operations
- * 
+ *
  * Defintions for TensorT's operations as Macros
  */
 
 #ifndef LINALG_OPERATIONS_HPP
 #define LINALG_OPERATIONS_HPP
 
-#define TENSOR_OPERATION(op, spec) \
-    spec TensorT operator op(const TensorT& rhs) spec {         \
-        TensorT newTensor;                                      \
-                                                                \
-        for (std::size_t i = 0; i < data.size(); i++) {         \
-            newTensor[i] = (operator[](i) op rhs[i]);           \
-        }                                                       \
-                                                                \
-        return newTensor;                                       \
-    }
+#include <linalg/expression.hpp>
+
+// builds a lazy expression, see expression.hpp
+#define EXPRESSION_OPERATION(op, functor)                                                          \
+template <typename L, typename R, EnableExpression<L, R> = 0>                                      \
+constexpr BinaryExpression<functor, Hold<L, R>, Hold<R, L>>                                        \
+operator op(const L& lhs, const R& rhs) {                                                          \
+    return {static_cast<Hold<L, R>>(lhs), static_cast<Hold<R, L>>(rhs)};                           \
+}
 
-#define FLOAT_OPERATION(op, spec) \
-    spec TensorT operator op(const float& rhs) spec {           \
-        TensorT newTensor;                                      \
-                                                                \
-        for (std::size_t i = 0; i < data.size(); i++) {         \
-            newTensor[i] = (operator[](i) op rhs);              \
-        }                                                       \
-                                                                \
-        return newTensor;                                       \
+// in place, no copy of the tensor is made or returned
+#define COMPOUND_OPERATION(op, functor)                                                            \
+    template <typename E, EnableCompound<E, TensorT> = 0>                                          \
+    constexpr TensorT& operator op(const E& rhs) {                                                 \
+        return *this = BinaryExpression<functor, const TensorT&, Hold<E, TensorT>>(                \
+            *this, static_cast<Hold<E, TensorT>>(rhs));                                            \
     }
 
-#define FLIPPED_FLOAT_VECTOR_OPERATION(op)                                               \
-template <int D1>                                                                        \
-TensorT<NumList<D1>> operator op(const float& lhs, const TensorT<NumList<D1>>& rhs) {    \
-    TensorT<NumList<D1>> result;                                             \
-    for (std::size_t i = 0; i < rhs.size(); ++i) {                                       \
-        result[i] = lhs op rhs[i];                                                       \
-    }                                                                                    \
-    return result;                                                                       \
-}
+// in place through a StridedView, written back to the tensor it views
+#define VIEW_COMPOUND_OPERATION(op, functor)                                                       \
+    template <typename E, EnableCompound<E, value_type> = 0>                                       \
+    constexpr const StridedView& operator op(const E& rhs) const {                                 \
+        return *this = BinaryExpression<functor, StridedView, Hold<E, value_type>>(                \
+            *this, static_cast<Hold<E, value_type>>(rhs));                                         \
+    }
 
-#define FLIPPED_FLOAT_TENSOR_OPERATION(op)                                                \
-template <int... D>                                                                       \
-TensorT<NumList<D...>> operator op(const float& lhs, const TensorT<NumList<D...>>& rhs) { \
-    TensorT<NumList<D...>> result;                                            \
-    for (std::size_t i = 0; i < rhs.size(); ++i) {                                        \
-        result[i] = lhs op rhs[i];                                                        \
-    }                                                                                     \
-    return result;                                                                        \
-}
+// evaluates an expression into the tensor in a single pass, as one flat loop
+// over all dimensions unless the expression reads a strided view. An expression
+// that reads the tensor through a view, like t = t.permute(0, 1) + t, goes
+// through a copy, since writing one index would change what another one reads
+#define EXPRESSION_EVALUATION                                                                      \
+    template <typename E, std::enable_if_t<IsExpression<E>::value, int> = 0>                       \
+    constexpr TensorT(const E& expression) {                                                       \
+        *this = expression;                                                                        \
+    }                                                                                              \
+                                                                                                   \
+    template <typename E, std::enable_if_t<IsExpression<E>::value, int> = 0>                       \
+    constexpr TensorT& operator=(const E& expression) {                                            \
+        static_assert(std::is_same_v<typename E::value_type, TensorT>, "Shapes do not match.");    \
+                                                                                                   \
+        if (std::is_constant_evaluated()) {                                                        \
+            evaluateRows(data(), expression);                                                      \
+        } else if (expression.aliases(*this)) {                                                    \
+            evaluateCopy(data(), expression);                                                      \
+        } else {                                                                                   \
+            evaluateTo(data(), expression);                                                        \
+        }                                                                                          \
+                                                                                                   \
+        return *this;                                                                              \
+    }
 
 #endif
\ No newline at end of file
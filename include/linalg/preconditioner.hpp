@@ -0,0 +1,73 @@
+/**
+ * @file preconditioner.hpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Preconditioners for the iterative solvers
+ *
+ * A preconditioner approximates A^-1 cheaply: apply(r, z) sets
+ * z = M^-1 r. Jacobi scales by the inverse diagonal, ILU(0)
+ * factors A on its own sparsity pattern and solves with both
+ * triangles. Both are built once from a sparse or dense Matrix
+ * and can then be shared by any number of solves.
+ */
+
+#ifndef LINALG_PRECONDITIONER_HPP
+#define LINALG_PRECONDITIONER_HPP
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include <linalg/matrix.hpp>
+#include <linalg/memory.hpp>
+#include <linalg/sparse.hpp>
+
+namespace Linalg {
+
+    // M = I, the default of every solver
+    class IdentityPreconditioner {
+        public:
+            void apply(std::span<const float> r, std::span<float> z) const;
+    };
+
+    // M = diag(A), every diagonal entry must be non zero
+    class JacobiPreconditioner {
+        public:
+            template <SparseLayout L>
+            explicit JacobiPreconditioner(const SparseMatrix<L>& a);
+
+            template <int N>
+            explicit JacobiPreconditioner(const Matrix<N, N>& a);
+
+            void apply(std::span<const float> r, std::span<float> z) const;
+
+        protected:
+            void invert();
+
+            AlignedVector<float> inverseDiagonal;
+    };
+
+    // M = L U with L and U only where A has non zeros, L with a unit diagonal.
+    // Throws std::runtime_error on a zero pivot, A is not pivoted
+    class Ilu0Preconditioner {
+        public:
+            explicit Ilu0Preconditioner(const CsrMatrix& a);
+            explicit Ilu0Preconditioner(const CscMatrix& a);
+
+            // a dense matrix is factored on the pattern of its non zeros,
+            // without pivoting, so that is a complete LU when none are zero
+            template <int N>
+            explicit Ilu0Preconditioner(const Matrix<N, N>& a);
+
+            void apply(std::span<const float> r, std::span<float> z) const;
+
+            // L below and U on and above the diagonal, on the pattern of A
+            const CsrMatrix& factors() const;
+
+        protected:
+            CsrMatrix lu;
+            std::vector<std::size_t> diagonal;
+    };
+}
+
+#endif
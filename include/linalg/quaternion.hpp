@@ -0,0 +1,75 @@
+/**
+ * @file quaternion.hpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Unit quaternions for rotations
+ *
+ * Contains the Quat class, stored as a Vec4 (x, y, z, w) with
+ * w the scalar part. Composing two rotations is 16 multiplies
+ * instead of the 27 of a Mat3 product, and a renormalize is
+ * enough to undo drift. Spans of vectors can be rotated by one
+ * quaternion or by one quaternion each, for skinning.
+ */
+
+#ifndef LINALG_QUATERNION_HPP
+#define LINALG_QUATERNION_HPP
+
+#include <span>
+
+#include <linalg/matrix.hpp>
+#include <linalg/vector.hpp>
+
+namespace Linalg {
+
+    class Quat : public Vec4 {
+        public:
+            Quat() = default;
+            Quat(std::initializer_list<float> list) : Vec4(list) {}
+            Quat(Vector<4> r) : Vec4(r) {}
+
+            static Quat identity();
+
+            // axis must be normalized, angle in radians
+            static Quat axisAngle(const Vec3& axis, float angle);
+
+            // the rotation part of the matrix, which must be orthonormal
+            static Quat fromMatrix(const Mat3& matrix);
+            static Quat fromMatrix(const Mat4& matrix);
+
+            Mat3 toMat3() const;
+            Mat4 toMat4() const;
+
+            Vec3 vector() const;
+
+            // Hamilton product, the rotation rhs followed by this one
+            Quat operator*(const Quat& rhs) const;
+
+            Quat conjugate() const;
+            Quat inverse() const;
+            Quat normalize() const;
+
+            // q v q*, with t = 2 (q.xyz x v) and v' = v + w t + q.xyz x t
+            Vec3 rotate(const Vec3& v) const;
+
+            // along the shorter arc, t in [0, 1]
+            Quat slerp(const Quat& to, float t) const;
+            Quat nlerp(const Quat& to, float t) const;
+    };
+
+    static_assert(sizeof(Quat) == 4 * sizeof(float), "Quat must be tightly packed");
+    static_assert(std::is_standard_layout_v<Quat> && std::is_trivially_copyable_v<Quat>);
+
+    // rotates every vector by one quaternion
+    void rotate(const Quat& rotation, std::span<const Vec3> in, std::span<Vec3> out);
+
+    // rotates in[i] by rotations[i]
+    void rotate(std::span<const Quat> rotations, std::span<const Vec3> in, std::span<Vec3> out);
+
+    // out[i] = a[i] * b[i]
+    void compose(std::span<const Quat> a, std::span<const Quat> b, std::span<Quat> out);
+
+    // out[i] = from[i].slerp(to[i], t)
+    void slerp(std::span<const Quat> from, std::span<const Quat> to, float t, std::span<Quat> out);
+}
+
+#endif
@@ -0,0 +1,66 @@
+/**
+ * @file reduction.hpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Reductions of a TensorT along one axis or over every element
+ *
+ * sum<Axis>(t) removes dimension Axis from the shape of t,
+ * so reducing a Tensor<4, 5, 6> along axis 1 gives a
+ * Tensor<4, 6>, and reducing a Vector gives a scalar. Sums
+ * along the contiguous axis and over whole tensors are
+ * pairwise, sums along other axes use Kahan compensation,
+ * so the error does not grow with the number of elements.
+ * sum, mean and norm add up in and return Accumulator<T>,
+ * so int8 totals do not wrap and Half totals do not round.
+ */
+
+#ifndef LINALG_REDUCTION_HPP
+#define LINALG_REDUCTION_HPP
+
+#include <type_traits>
+
+#include <linalg/tensor.hpp>
+#include <linalg/varargs.hpp>
+#include <linalg/vector.hpp>
+
+namespace Linalg {
+
+    // the shape left after removing dimension Axis, a scalar for a vector
+    template <typename List, int Axis, typename T>
+    using Reduced = std::conditional_t<GetSize<List>::value == 1, T,
+        TensorT<typename RemoveItem<List, Axis>::value, T>>;
+
+    template <int Axis, int... D, typename T>
+    Reduced<NumList<D...>, Axis, Accumulator<T>> sum(const TensorT<NumList<D...>, T>& tensor);
+
+    template <int Axis, int... D, typename T>
+    Reduced<NumList<D...>, Axis, Accumulator<T>> mean(const TensorT<NumList<D...>, T>& tensor);
+
+    template <int Axis, int... D, typename T>
+    Reduced<NumList<D...>, Axis, T> max(const TensorT<NumList<D...>, T>& tensor);
+
+    template <int Axis, int... D, typename T>
+    Reduced<NumList<D...>, Axis, T> min(const TensorT<NumList<D...>, T>& tensor);
+
+    // euclidean length of every line along Axis
+    template <int Axis, int... D, typename T>
+    Reduced<NumList<D...>, Axis, Accumulator<T>> norm(const TensorT<NumList<D...>, T>& tensor);
+
+    // over every element, norm is the Frobenius norm
+    template <typename T, int... D>
+    Accumulator<T> sum(const TensorT<NumList<D...>, T>& tensor);
+
+    template <typename T, int... D>
+    Accumulator<T> mean(const TensorT<NumList<D...>, T>& tensor);
+
+    template <typename T, int... D>
+    T max(const TensorT<NumList<D...>, T>& tensor);
+
+    template <typename T, int... D>
+    T min(const TensorT<NumList<D...>, T>& tensor);
+
+    template <typename T, int... D>
+    Accumulator<T> norm(const TensorT<NumList<D...>, T>& tensor);
+}
+
+#endif
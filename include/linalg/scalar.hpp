@@ -0,0 +1,74 @@
+/**
+ * @file scalar.hpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief 16 bit floating point storage types
+ *
+ * Contains Half (IEEE binary16) and BFloat16. Both are
+ * storage formats: they convert to float for arithmetic
+ * and round back to nearest even when stored, which halves
+ * the memory traffic of bandwidth bound tensors.
+ */
+
+#ifndef LINALG_SCALAR_HPP
+#define LINALG_SCALAR_HPP
+
+#include <cstdint>
+#include <type_traits>
+
+namespace Linalg {
+
+    class Half {
+        public:
+            Half() = default;
+            Half(float value);
+
+            operator float() const;
+
+            static Half fromBits(std::uint16_t bits);
+            std::uint16_t toBits() const;
+
+        protected:
+            std::uint16_t bits;
+    };
+
+    class BFloat16 {
+        public:
+            BFloat16() = default;
+            BFloat16(float value);
+
+            operator float() const;
+
+            static BFloat16 fromBits(std::uint16_t bits);
+            std::uint16_t toBits() const;
+
+        protected:
+            std::uint16_t bits;
+    };
+
+    static_assert(sizeof(Half) == 2 && std::is_trivially_copyable_v<Half>);
+    static_assert(sizeof(BFloat16) == 2 && std::is_trivially_copyable_v<BFloat16>);
+
+    // element types a TensorT can hold
+    template <typename T>
+    struct IsScalar {
+        static constexpr bool value = std::is_arithmetic_v<T>;
+    };
+
+    template <>
+    struct IsScalar<Half> {
+        static constexpr bool value = true;
+    };
+
+    template <>
+    struct IsScalar<BFloat16> {
+        static constexpr bool value = true;
+    };
+
+    // what sums and dot products of T accumulate in: int for the narrow integers,
+    // as promotion gives, and float for Half and BFloat16 through their conversion
+    template <typename T>
+    using Accumulator = decltype(+T{});
+}
+
+#endif
\ No newline at end of file
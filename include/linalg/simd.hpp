@@ -0,0 +1,84 @@
+/**
+ * @file simd.hpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief SIMD packets and vectorized float kernels
+ *
+ * Wraps the widest instruction set enabled at compile time
+ * (AVX-512, AVX or SSE) behind a single Packet type, with a
+ * scalar fallback. Define LINALG_NO_SIMD to force the fallback.
+ */
+
+#ifndef LINALG_SIMD_HPP
+#define LINALG_SIMD_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#if !defined(LINALG_NO_SIMD) && (defined(__AVX512F__) || defined(__AVX__) || defined(__SSE2__))
+#include <immintrin.h>
+#endif
+
+namespace Linalg::Simd {
+
+#if !defined(LINALG_NO_SIMD) && defined(__AVX512F__)
+    typedef __m512 Native;
+    constexpr std::size_t WIDTH = 16;
+#elif !defined(LINALG_NO_SIMD) && defined(__AVX__)
+    typedef __m256 Native;
+    constexpr std::size_t WIDTH = 8;
+#elif !defined(LINALG_NO_SIMD) && defined(__SSE2__)
+    typedef __m128 Native;
+    constexpr std::size_t WIDTH = 4;
+#else
+    typedef float Native;
+    constexpr std::size_t WIDTH = 1;
+#endif
+
+    // WIDTH floats processed as one register
+    struct Packet {
+        Native v;
+    };
+
+    inline Packet load(const float* p);
+    inline void store(float* p, Packet a);
+    inline Packet broadcast(float value);
+
+    // base[indices[0]], base[indices[1]] ... for WIDTH indices
+    inline Packet gather(const float* base, const std::int32_t* indices);
+
+    inline Packet add(Packet a, Packet b);
+    inline Packet sub(Packet a, Packet b);
+    inline Packet mul(Packet a, Packet b);
+    inline Packet div(Packet a, Packet b);
+    inline Packet sqrt(Packet a);
+    inline Packet max(Packet a, Packet b);
+    inline Packet min(Packet a, Packet b);
+
+    // a * b + c
+    inline Packet fma(Packet a, Packet b, Packet c);
+    inline float reduce(Packet a);
+    inline float reduceMax(Packet a);
+    inline float reduceMin(Packet a);
+
+    // ranges longer than this are summed as two halves, so the
+    // rounding error grows with log(n) instead of n
+    constexpr std::size_t PAIRWISE_BLOCK = 1024;
+
+    inline float dot(const float* a, const float* b, std::size_t n);
+    inline float sum(const float* a, std::size_t n);
+
+    // y += a * x
+    inline void axpy(float a, const float* x, float* y, std::size_t n);
+
+    // n must be at least 1
+    inline float max(const float* a, std::size_t n);
+    inline float min(const float* a, std::size_t n);
+
+#if !defined(LINALG_NO_SIMD) && defined(__SSE2__)
+    // adjugate of a row-major 4x4 matrix in four SSE registers, returns the determinant
+    inline float adjugate4(const float* m, float* out);
+#endif
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,114 @@
+/**
+ * @file solver.hpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Iterative solvers for A x = b
+ *
+ * Contains ConjugateGradient (A symmetric positive definite),
+ * BiCgStab and Gmres (any invertible A). They only need y = A x:
+ * A can be a SparseMatrix, a square Matrix or any callable
+ * f(std::span<const float> x, std::span<float> y). x holds the
+ * initial guess on entry and the solution on exit. Each solver
+ * keeps its work buffers between calls, so repeated solves of
+ * the same size do not allocate. With par the products of a
+ * CSR matrix are split over the pool, the vector updates always
+ * run on the calling thread.
+ *
+ *     ConjugateGradient cg({.tolerance = 1e-5f});
+ *     SolverReport report = cg.solve(la::par, a, b, x, Ilu0Preconditioner(a));
+ */
+
+#ifndef LINALG_SOLVER_HPP
+#define LINALG_SOLVER_HPP
+
+#include <cstddef>
+#include <functional>
+#include <span>
+
+#include <linalg/execution.hpp>
+#include <linalg/matrix.hpp>
+#include <linalg/memory.hpp>
+#include <linalg/preconditioner.hpp>
+#include <linalg/sparse.hpp>
+
+namespace Linalg {
+
+    struct SolverOptions {
+        // stop once ||b - A x|| <= tolerance * ||b||
+        float tolerance = 1e-5f;
+        std::size_t maxIterations = 1000;
+
+        // Krylov vectors kept by Gmres before it restarts
+        std::size_t restart = 30;
+
+        // called after every iteration with its number and relative residual
+        std::function<void(std::size_t, float)> monitor{};
+    };
+
+    struct SolverReport {
+        std::size_t iterations = 0;
+
+        // ||b - A x|| / ||b|| as the method tracks it. Gmres recomputes it at every restart
+        // that is not the last. Single precision puts a floor of about cond(A) * 1e-7 under
+        // the true residual, the tracked one keeps falling below it
+        float residual = 0;
+        bool converged = false;
+    };
+
+    class ConjugateGradient {
+        public:
+            ConjugateGradient(SolverOptions options = {});
+
+            template <typename Policy, typename Operator, typename Preconditioner = IdentityPreconditioner>
+            SolverReport solve(const Policy& policy, const Operator& a, std::span<const float> b, std::span<float> x,
+                const Preconditioner& m = {});
+
+            template <typename Operator, typename Preconditioner = IdentityPreconditioner>
+            SolverReport solve(const Operator& a, std::span<const float> b, std::span<float> x, const Preconditioner& m = {});
+
+            SolverOptions options;
+
+        protected:
+            AlignedVector<float> r, z, p, q;
+    };
+
+    // stabilized bi-conjugate gradient, preconditioned on the right
+    class BiCgStab {
+        public:
+            BiCgStab(SolverOptions options = {});
+
+            template <typename Policy, typename Operator, typename Preconditioner = IdentityPreconditioner>
+            SolverReport solve(const Policy& policy, const Operator& a, std::span<const float> b, std::span<float> x,
+                const Preconditioner& m = {});
+
+            template <typename Operator, typename Preconditioner = IdentityPreconditioner>
+            SolverReport solve(const Operator& a, std::span<const float> b, std::span<float> x, const Preconditioner& m = {});
+
+            SolverOptions options;
+
+        protected:
+            AlignedVector<float> r, rHat, p, v, s, t, y, z;
+    };
+
+    // restarted GMRES with modified Gram-Schmidt and Givens rotations, preconditioned on the right
+    class Gmres {
+        public:
+            Gmres(SolverOptions options = {});
+
+            template <typename Policy, typename Operator, typename Preconditioner = IdentityPreconditioner>
+            SolverReport solve(const Policy& policy, const Operator& a, std::span<const float> b, std::span<float> x,
+                const Preconditioner& m = {});
+
+            template <typename Operator, typename Preconditioner = IdentityPreconditioner>
+            SolverReport solve(const Operator& a, std::span<const float> b, std::span<float> x, const Preconditioner& m = {});
+
+            SolverOptions options;
+
+        protected:
+            // restart + 1 basis vectors of n floats, then the (restart + 1) x restart Hessenberg matrix
+            AlignedVector<float> basis, hessenberg;
+            AlignedVector<float> cosines, sines, g, w, z;
+    };
+}
+
+#endif
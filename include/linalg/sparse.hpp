@@ -0,0 +1,143 @@
+/**
+ * @file sparse.hpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Runtime sized sparse matrices in CSR and CSC format
+ *
+ * Contains SparseTriplets, which collects (row, column, value)
+ * entries in any order, and SparseMatrix, which compresses them
+ * by rows (CsrMatrix) or by columns (CscMatrix). Duplicate
+ * entries are summed, the usual way finite element matrices are
+ * assembled. Products take a policy like assign: with par, CSR
+ * products are split over the rows once the matrix has at least
+ * PARALLEL_THRESHOLD non zeros. CSC products scatter into the
+ * result and always run on the calling thread.
+ *
+ *     SparseTriplets t(n, n);
+ *     t.add(i, j, value);
+ *     CsrMatrix a(t);
+ *     la::multiply(la::par, a, x.span(), y.span());
+ */
+
+#ifndef LINALG_SPARSE_HPP
+#define LINALG_SPARSE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <linalg/dynamic_tensor.hpp>
+#include <linalg/execution.hpp>
+#include <linalg/memory.hpp>
+#include <linalg/tensor.hpp>
+
+namespace Linalg {
+
+    enum class SparseLayout { Rows, Columns };
+
+    // coordinate (COO) entries of a rows x columns matrix, in any order
+    class SparseTriplets {
+        public:
+            SparseTriplets(std::size_t rows, std::size_t columns);
+
+            void reserve(std::size_t count);
+            void clear();
+
+            // entries at the same position are summed when compressed
+            void add(std::size_t row, std::size_t column, float value);
+
+            std::size_t rows() const;
+            std::size_t columns() const;
+            std::size_t size() const;
+
+            std::span<const std::size_t> rowIndices() const;
+            std::span<const std::size_t> columnIndices() const;
+            std::span<const float> values() const;
+
+        protected:
+            std::size_t rowCount;
+            std::size_t columnCount;
+            std::vector<std::size_t> rowIndex;
+            std::vector<std::size_t> columnIndex;
+            std::vector<float> entries;
+    };
+
+    // compressed by rows (Rows, CSR) or by columns (Columns, CSC). The outer
+    // dimension is the rows of a CSR matrix and the columns of a CSC matrix
+    template <SparseLayout L>
+    class SparseMatrix {
+        public:
+            static constexpr SparseLayout layout = L;
+            static constexpr SparseLayout transposed = L == SparseLayout::Rows ? SparseLayout::Columns : SparseLayout::Rows;
+
+            SparseMatrix() = default;
+
+            // a rows x columns matrix of zeros
+            SparseMatrix(std::size_t rows, std::size_t columns);
+            explicit SparseMatrix(const SparseTriplets& triplets);
+
+            // takes compressed arrays as they are, indices must be sorted within each outer entry
+            SparseMatrix(std::size_t rows, std::size_t columns, std::vector<std::size_t> offsets,
+                AlignedVector<std::int32_t> indices, AlignedVector<float> values);
+
+            // converts between CSR and CSC
+            explicit SparseMatrix(const SparseMatrix<transposed>& other);
+
+            // the non zeros of a dense Matrix<N, V>
+            template <int V, int N>
+            explicit SparseMatrix(const TensorT<NumList<V, N>>& dense);
+
+            std::size_t rows() const;
+            std::size_t columns() const;
+            std::size_t nonZeros() const;
+
+            // the entries of outer index k are [offsets[k], offsets[k + 1]) of indices and values
+            std::span<const std::size_t> offsets() const;
+            std::span<const std::int32_t> indices() const;
+            std::span<const float> values() const;
+            std::span<float> values();
+
+            // zero where nothing is stored
+            float at(std::size_t row, std::size_t column) const;
+
+            // the same arrays read the other way, a CSR A is a CSC A^T
+            SparseMatrix<transposed> transpose() const;
+
+            // shape {columns, rows} like a Matrix<rows, columns>
+            DynamicTensor dense() const;
+
+            // rhs of shape {columns} is a vector, {k, columns} a dense columns x k matrix
+            DynamicTensor operator*(const DynamicTensor& rhs) const;
+
+            // a Vector<columns> or a Matrix<columns, k>
+            template <int... D>
+            DynamicTensor operator*(const TensorT<NumList<D...>>& rhs) const;
+
+        protected:
+            template <SparseLayout>
+            friend class SparseMatrix;
+
+            std::size_t outerCount() const;
+            std::size_t innerCount() const;
+
+            std::size_t rowCount = 0;
+            std::size_t columnCount = 0;
+            std::vector<std::size_t> starts = {0};
+            AlignedVector<std::int32_t> inner;
+            AlignedVector<float> entries;
+    };
+
+    using CsrMatrix = SparseMatrix<SparseLayout::Rows>;
+    using CscMatrix = SparseMatrix<SparseLayout::Columns>;
+
+    // y = A x, x has a.columns() elements and y a.rows(). y must not overlap x
+    template <typename Policy, SparseLayout L>
+    void multiply(const Policy& policy, const SparseMatrix<L>& a, std::span<const float> x, std::span<float> y);
+
+    // C = A B with B a dense a.columns() x k matrix and C a.rows() x k, both row-major like Matrix
+    template <typename Policy, SparseLayout L>
+    void multiply(const Policy& policy, const SparseMatrix<L>& a, std::span<const float> b, std::span<float> c, std::size_t k);
+}
+
+#endif
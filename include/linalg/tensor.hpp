@@ -6,80 +6,109 @@
  * 
  * This file contains the main logic for the TensorT class
  * Since the class definition is recursive the base case is
- * a vector
+ * a vector. A tensor of rank 2 or more stores its elements
+ * in one flat array, dimension 0 varying fastest, reached
+ * through data() and span(). Its subscript returns a view
+ * of the row, see view.hpp.
  */
 
 #ifndef LINALG_TENSOR_HPP
 #define LINALG_TENSOR_HPP
 
 #include <array>
+#include <cstddef>
 #include <initializer_list>
+#include <span>
+#include <string>
 
 #include <linalg/varargs.hpp>
 #include <linalg/operations.hpp>
+#include <linalg/scalar.hpp>
+#include <linalg/view.hpp>
 
 #define permute(a, b) __permute<a, b>()
 
 namespace Linalg {
 
-    template <typename>
+    // the element type defaults to float, see scalar.hpp for the 16 bit types
+    template <typename, typename = float>
     class TensorT;
 
     template <int... Dims>
     using Tensor = TensorT<NumList<Dims...>>;
 
-    template <int D1, int D2, int ...D>
-    TensorT<typename SwapItems<NumList<D...>, D1, D2>::value> __permuteFunc(TensorT<NumList<D...>> tensor);
-
-    template <int ...D>
-    class TensorT<NumList<D...>> {
+    template <typename T, int... Dims>
+    using TensorOf = TensorT<NumList<Dims...>, T>;
+
+    // tensors of at least a cache line start on one and are padded to a whole number
+    // of them. Smaller ones keep their packed size, so that arrays of Vec3, Mat3 or
+    // Affine3 stay dense, and are aligned to the largest power of two dividing it
+    constexpr std::size_t tensorAlignment(std::size_t bytes) {
+        if (bytes >= 64) {
+            return 64;
+        }
+
+        std::size_t alignment = 32;
+        while (bytes % alignment != 0) {
+            alignment /= 2;
+        }
+        return alignment;
+    }
+
+    template <int ...D, typename T>
+    class alignas(tensorAlignment(sizeof(T) * (static_cast<std::size_t>(D) * ...))) TensorT<NumList<D...>, T> {
         public:
+            typedef T scalar_type;
+
+            // number of elements over all dimensions
+            static constexpr std::size_t count = (static_cast<std::size_t>(D) * ...);
+
+            // a row, the tensor of one index of the last dimension
+            typedef TensorT<typename PopBack<NumList<D...>>::value, T> row_type;
 
             TensorT() = default;
-            TensorT(std::initializer_list<TensorT<typename PopBack<NumList<D...>>::value>> list);
-            TensorT(float value);
+            constexpr TensorT(std::initializer_list<row_type> list);
+            constexpr TensorT(T value);
 
+            // a strided view of the same storage, assign it to a TensorT to copy it
             template <int D1, int D2>
-            TensorT<typename SwapItems<NumList<D...>, D1, D2>::value> __permute() { return __permuteFunc<D1, D2, D...>(*this); }
+            StridedView<typename SwapItems<NumList<D...>, D1, D2>::value, T> __permute();
+            template <int D1, int D2>
+            StridedView<typename SwapItems<NumList<D...>, D1, D2>::value, const T> __permute() const;
 
-            std::size_t size() const;
-            std::array<std::size_t, GetSize<NumList<D...>>::value> shape() const;
-            TensorT<typename PopBack<NumList<D...>>::value>& operator[](std::size_t index);
-            const TensorT<typename PopBack<NumList<D...>>::value>& operator[](std::size_t index) const;
-            float& getList(std::array<std::size_t, GetSize<NumList<D...>>::value> indices);
-            
-            TENSOR_OPERATION(+, const);
-            TENSOR_OPERATION(-, const);
-            TENSOR_OPERATION(*, const);
-            TENSOR_OPERATION(/, const);
-
-            FLOAT_OPERATION(+, const);
-            FLOAT_OPERATION(-, const);
-            FLOAT_OPERATION(*, const);
-            FLOAT_OPERATION(/, const);
-
-            TENSOR_OPERATION(+=,);
-            TENSOR_OPERATION(-=,);
-            TENSOR_OPERATION(*=,);
-            TENSOR_OPERATION(/=,);
-
-            FLOAT_OPERATION(+=,);
-            FLOAT_OPERATION(-=,);
-            FLOAT_OPERATION(*=,);
-            FLOAT_OPERATION(/=,);
+            constexpr std::size_t size() const;
+            constexpr std::array<std::size_t, sizeof...(D)> shape() const;
+
+            // a view of the row, which writes through to the tensor
+            constexpr StridedView<typename PopBack<NumList<D...>>::value, T> operator[](std::size_t index);
+            constexpr StridedView<typename PopBack<NumList<D...>>::value, const T> operator[](std::size_t index) const;
+            constexpr T& getList(std::array<std::size_t, sizeof...(D)> indices);
+
+            // the elements as one buffer, for memcpy, I/O or external kernels. It is
+            // aligned to tensorAlignment, the padding after it is not part of the span
+            constexpr T* data();
+            constexpr const T* data() const;
+            constexpr std::span<T, count> span();
+            constexpr std::span<const T, count> span() const;
+
+            // nested groups, dimension 0 innermost, see format.hpp for other layouts
+            std::string string() const;
             
+            EXPRESSION_EVALUATION
+
+            COMPOUND_OPERATION(+=, AddOp);
+            COMPOUND_OPERATION(-=, SubOp);
+            COMPOUND_OPERATION(*=, MulOp);
+            COMPOUND_OPERATION(/=, DivOp);
 
         protected:
-            std::array<
-                TensorT<typename PopBack<NumList<D...>>::value>, 
-                GetItem<NumList<D...>, GetSize<NumList<D...>>::value-1>::element
-            > data;
+            std::array<T, count> elements;
     };
 
-    FLIPPED_FLOAT_TENSOR_OPERATION(+);
-    FLIPPED_FLOAT_TENSOR_OPERATION(-);
-    FLIPPED_FLOAT_TENSOR_OPERATION(*);
-    FLIPPED_FLOAT_TENSOR_OPERATION(/);
+    EXPRESSION_OPERATION(+, AddOp);
+    EXPRESSION_OPERATION(-, SubOp);
+    EXPRESSION_OPERATION(*, MulOp);
+    EXPRESSION_OPERATION(/, DivOp);
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,135 @@
+/**
+ * @file tensor_file.hpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Binary tensor files, memory mapped for loading
+ *
+ * A tensor file is a 32 byte header, the shape as rank 64 bit
+ * integers and then the raw elements, starting on a cache line
+ * so a mapping can be read with aligned SIMD loads. Elements and
+ * shape are in the order TensorT stores them, the first index
+ * varying fastest. Files are written in native byte order, which
+ * the header records, and files of the other order are refused
+ * since a mapping cannot swap bytes without copying.
+ *
+ *     saveTensor("weights.ltf", weights);
+ *     MappedTensor file("weights.ltf");
+ *     const Tensor<256, 256>& w = file.as<float, 256, 256>();
+ */
+
+#ifndef LINALG_TENSOR_FILE_HPP
+#define LINALG_TENSOR_FILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <linalg/dynamic_tensor.hpp>
+#include <linalg/scalar.hpp>
+#include <linalg/tensor.hpp>
+
+namespace Linalg {
+
+    constexpr std::uint16_t TENSOR_FILE_VERSION = 1;
+
+    enum class DType : std::uint8_t { Float32 = 1, Float64 = 2, Float16 = 3, BFloat16 = 4 };
+
+    template <typename T>
+    struct DTypeOf;
+
+    template <> struct DTypeOf<float> { static constexpr DType value = DType::Float32; };
+    template <> struct DTypeOf<double> { static constexpr DType value = DType::Float64; };
+    template <> struct DTypeOf<Half> { static constexpr DType value = DType::Float16; };
+    template <> struct DTypeOf<BFloat16> { static constexpr DType value = DType::BFloat16; };
+
+    std::size_t dtypeSize(DType dtype);
+
+    struct TensorFileHeader {
+        char magic[4];
+        std::uint16_t version;
+        DType dtype;
+        // 1 for little endian, 2 for big endian
+        std::uint8_t byteOrder;
+        std::uint32_t rank;
+        // of dataOffset, at least CACHE_LINE
+        std::uint32_t alignment;
+        std::uint64_t dataOffset;
+        std::uint64_t count;
+    };
+
+    static_assert(sizeof(TensorFileHeader) == 32, "The header layout is part of the format");
+
+    template <int... D, typename T>
+    void saveTensor(const std::string& path, const TensorT<NumList<D...>, T>& tensor);
+    void saveTensor(const std::string& path, const DynamicTensor& tensor);
+
+    // copies a file into a tensor of the same type and shape
+    template <int... D, typename T>
+    void loadTensor(const std::string& path, TensorT<NumList<D...>, T>& tensor);
+
+    // appends elements to a file as they come, for tensors larger than memory.
+    // the header is written first, so the shape must be known up front
+    class TensorWriter {
+        public:
+            TensorWriter(const std::string& path, std::vector<std::size_t> shape, DType dtype = DType::Float32);
+            TensorWriter(const TensorWriter&) = delete;
+            TensorWriter& operator=(const TensorWriter&) = delete;
+            ~TensorWriter();
+
+            template <typename T>
+            void write(std::span<const T> elements);
+
+            std::size_t written() const;
+            std::size_t size() const;
+
+            // throws if fewer or more elements than the shape holds were written
+            void close();
+
+        protected:
+            std::FILE* file = nullptr;
+            DType type;
+            std::size_t count = 0;
+            std::size_t total = 0;
+    };
+
+    // a read only file mapped copy-on-write: elements can be changed
+    // through the views, but the changes never reach the file
+    class MappedTensor {
+        public:
+            explicit MappedTensor(const std::string& path);
+            MappedTensor(const MappedTensor&) = delete;
+            MappedTensor& operator=(const MappedTensor&) = delete;
+            MappedTensor(MappedTensor&& other) noexcept;
+            MappedTensor& operator=(MappedTensor&& other) noexcept;
+            ~MappedTensor();
+
+            const std::vector<std::size_t>& shape() const;
+            DType dtype() const;
+            std::size_t size() const;
+
+            // the elements in place, T must match the file's dtype
+            template <typename T>
+            std::span<T> span();
+
+            // the mapping as a fixed size tensor, type and shape must match the file
+            template <typename T, int... D>
+            TensorT<NumList<D...>, T>& as();
+
+            // a non owning DynamicTensor over a Float32 file
+            DynamicTensor view();
+
+        protected:
+            void release();
+
+            void* mapping = nullptr;
+            std::size_t length = 0;
+            std::byte* elements = nullptr;
+            std::vector<std::size_t> dims;
+            DType type = DType::Float32;
+    };
+}
+
+#endif
@@ -0,0 +1,71 @@
+/**
+ * @file thread_pool.hpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Shared worker threads for splitting large workloads
+ *
+ * Contains the ThreadPool class. Work is handed out as
+ * index ranges through parallelFor, and the calling thread
+ * runs queued work itself while it waits. Every worker has
+ * its own queue and steals from the others when it is empty.
+ */
+
+#ifndef LINALG_THREAD_POOL_HPP
+#define LINALG_THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Linalg {
+
+    class ThreadPool {
+        public:
+            ThreadPool(std::size_t workers);
+            ~ThreadPool();
+
+            ThreadPool(const ThreadPool&) = delete;
+            ThreadPool& operator=(const ThreadPool&) = delete;
+
+            // one worker per hardware thread, minus the caller
+            static ThreadPool& instance();
+
+            // threads available to parallelFor, including the caller
+            std::size_t concurrency() const;
+
+            // calls body(first, last) over [begin, end) in chunks of at least grain. The first
+            // exception thrown by body is rethrown here, after every chunk has finished
+            template <typename F>
+            void parallelFor(std::size_t begin, std::size_t end, std::size_t grain, F&& body);
+
+        protected:
+            struct Queue {
+                std::mutex mutex;
+                std::deque<std::function<void()>> tasks;
+            };
+
+            void submit(std::function<void()> task);
+            bool runOne();
+            bool pop(std::size_t queue, bool newest, std::function<void()>& task);
+            void work(std::size_t index);
+
+            // queue of the calling thread, the last queue belongs to threads outside the pool
+            std::size_t ownQueue() const;
+
+            std::vector<std::thread> threads;
+            std::vector<std::unique_ptr<Queue>> queues;
+            std::atomic<std::size_t> pending = 0;
+            std::atomic<std::size_t> nextVictim = 0;
+            std::mutex sleepMutex;
+            std::condition_variable available;
+            bool stopping = false;
+    };
+}
+
+#endif
\ No newline at end of file
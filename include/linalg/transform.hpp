@@ -0,0 +1,43 @@
+/**
+ * @file transform.hpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Batched Mat4 transforms over spans of vectors
+ *
+ * Transforms whole spans of Vec3/Vec4 by a Mat4. Points are
+ * transposed into small SoA blocks so the matrix stays in
+ * registers and SIMD runs across points, and large spans are
+ * split over the ThreadPool.
+ */
+
+#ifndef LINALG_TRANSFORM_HPP
+#define LINALG_TRANSFORM_HPP
+
+#include <cstddef>
+#include <span>
+
+#include <linalg/matrix.hpp>
+#include <linalg/vector.hpp>
+
+namespace Linalg {
+
+    // points per SoA block, small enough to stay in L1
+    constexpr std::size_t TRANSFORM_BLOCK = 64;
+
+    // spans shorter than this stay on the calling thread
+    constexpr std::size_t TRANSFORM_PARALLEL_THRESHOLD = 1 << 16;
+
+    // M * (v, 1), V is a 3 or 4 component vector
+    template <typename V>
+    void transformPoints(const Mat4& matrix, std::span<const V> in, std::span<V> out);
+
+    // M * (v, 0), translation is ignored
+    template <typename V>
+    void transformDirections(const Mat4& matrix, std::span<const V> in, std::span<V> out);
+
+    // M * v using each vector's own w
+    template <typename V>
+    void transform(const Mat4& matrix, std::span<const V> in, std::span<V> out);
+}
+
+#endif
\ No newline at end of file
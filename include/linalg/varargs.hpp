@@ -11,6 +11,10 @@
 #ifndef LINALG_VARARGS_HPP
 #define LINALG_VARARGS_HPP
 
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
 namespace Linalg {
     template<int...>
     struct NumList;
@@ -48,51 +52,127 @@ namespace Linalg {
         enum {value = sizeof...(T)};
     };
 
+    // the items of a list as an array, so that an item is read in one step
+    // instead of through one instantiation per position before it
+    template <int... T>
+    inline constexpr int ITEMS[sizeof...(T) + 1] = {T..., 0};
+
     template <typename List, int N, typename = void>
-    struct GetItem {
-        static_assert(N > 0, "index cannot be negative");
-        static_assert(GetSize<List>::value > 0, "index too high");
-        enum {element = GetItem<typename List::tail, N-1>::element};
+    struct GetItem;
+
+    template <int... T, int N>
+    struct GetItem<NumList<T...>, N> {
+        static_assert(N >= 0, "index cannot be negative");
+        static_assert(N < int(sizeof...(T)), "index too high");
+        enum {element = ITEMS<T...>[N]};
+    };
+
+    template <typename List, int N, int V, typename = std::make_index_sequence<GetSize<List>::value>>
+    struct SetItem;
+
+    template <int... T, int N, int V, std::size_t... I>
+    struct SetItem<NumList<T...>, N, V, std::index_sequence<I...>> {
+        static_assert(N >= 0, "index cannot be negative");
+        static_assert(N < int(sizeof...(T)), "index too high");
+        typedef NumList<(int(I) == N ? V : T)...> value;
+    };
+
+    // the items of List at Skip(I) for each I, where Skip steps over position N
+    template <typename List, int N, typename Indices>
+    struct SkipItem;
+
+    template <int... T, int N, std::size_t... I>
+    struct SkipItem<NumList<T...>, N, std::index_sequence<I...>> {
+        typedef NumList<ITEMS<T...>[int(I) < N ? I : I + 1]...> value;
+    };
+
+    template <typename List, int N>
+    struct RemoveItem {
+        static_assert(N >= 0, "index cannot be negative");
+        static_assert(N < GetSize<List>::value, "index too high");
+        typedef typename SkipItem<List, N, std::make_index_sequence<GetSize<List>::value - 1>>::value value;
+    };
+
+    template <typename List, int A, int B, typename = std::make_index_sequence<GetSize<List>::value>>
+    struct SwapItems;
+
+    template <int... T, int A, int B, std::size_t... I>
+    struct SwapItems<NumList<T...>, A, B, std::index_sequence<I...>> {
+        static_assert(A >= 0 && B >= 0, "index cannot be negative");
+        static_assert(A < int(sizeof...(T)) && B < int(sizeof...(T)), "index too high");
+        typedef NumList<(int(I) == A ? ITEMS<T...>[B] : int(I) == B ? ITEMS<T...>[A] : T)...> value;
     };
 
     template <typename List>
-    struct GetItem<List, 0> {
-        static_assert(GetSize<List>::value > 0, "index too high");
-        enum {element = List::head};
+    struct PopBack {
+        static_assert(GetSize<List>::value > 0, "cannot pop from an empty list");
+        typedef typename SkipItem<List, GetSize<List>::value - 1, std::make_index_sequence<GetSize<List>::value - 1>>::value value;
     };
 
-    template <typename List, int N, int V>
-    struct SetItem {
-        static_assert(N > 0, "index cannot be negative");
-        static_assert(GetSize<List>::value > 0, "index too high");
-        typedef typename Prepend<List::head, 
-                                typename SetItem<typename List::tail, N-1, V>::value>
-            ::value value;
+    // position of V in List, -1 when it is absent
+    template <typename List, int V>
+    struct IndexOf;
+
+    template <int V>
+    struct IndexOf<NumList<>, V> {
+        enum {value = -1};
     };
 
-    template <int New, int Old, int ...T>
-    struct SetItem<NumList<Old, T...>, 0, New> {
-        typedef NumList<New, T...> value;
+    template <int H, int... T, int V>
+    struct IndexOf<NumList<H, T...>, V> {
+        enum {value = H == V ? 0 : (IndexOf<NumList<T...>, V>::value < 0 ? -1 : 1 + IndexOf<NumList<T...>, V>::value)};
     };
 
-    template<typename List, int A, int B>
-    struct SwapItems {
-        typedef typename SetItem<typename SetItem<List, A, GetItem<List, B>::element>::value,
-                    B, GetItem<List, A>::element>::value value;
+    // items of A that are (Keep) or are not (!Keep) in B, in the order of A
+    template <typename A, typename B, bool Keep>
+    struct Partition;
+
+    template <typename B, bool Keep>
+    struct Partition<NumList<>, B, Keep> {
+        typedef NumList<> value;
+    };
+
+    template <int H, int... T, typename B, bool Keep>
+    struct Partition<NumList<H, T...>, B, Keep> {
+        typedef typename Partition<NumList<T...>, B, Keep>::value rest;
+        typedef std::conditional_t<(IndexOf<B, H>::value >= 0) == Keep,
+            typename Prepend<H, rest>::value, rest> value;
     };
 
-    template<typename>
-    struct PopBack;
+    template <typename A, typename B>
+    using Intersect = typename Partition<A, B, true>::value;
+
+    template <typename A, typename B>
+    using Difference = typename Partition<A, B, false>::value;
+
+    // Items[IndexOf<Keys, K>] for every K of Selected
+    template <typename Items, typename Keys, typename Selected>
+    struct Gather;
+
+    template <typename Items, typename Keys, int... K>
+    struct Gather<Items, Keys, NumList<K...>> {
+        typedef NumList<GetItem<Items, IndexOf<Keys, K>::value>::element...> value;
+    };
+
+    template <typename List>
+    struct Product;
 
     template <int... N>
-    struct PopBack<NumList<N...>> {
-        typedef typename Prepend<NumList<N...>::head, 
-                            typename PopBack<typename NumList<N...>::tail>::value>::value value;
+    struct Product<NumList<N...>> {
+        static constexpr long value = (1L * ... * N);
     };
 
-    template<int T>
-    struct PopBack<NumList<T>> {
-        typedef NumList<> value;
+    template <typename List>
+    struct IsUnique;
+
+    template <>
+    struct IsUnique<NumList<>> {
+        static constexpr bool value = true;
+    };
+
+    template <int H, int... T>
+    struct IsUnique<NumList<H, T...>> {
+        static constexpr bool value = IndexOf<NumList<T...>, H>::value < 0 && IsUnique<NumList<T...>>::value;
     };
 }
 
@@ -17,117 +17,114 @@
 #include <string>
 #include <cmath>
 #include <sstream>
+#include <type_traits>
 
+#include <linalg/simd.hpp>
 #include <linalg/tensor.hpp>
 
 namespace Linalg {
 
-    template <int N>
-    using Vector = Tensor<N>;
+    template <int N, typename T = float>
+    using Vector = TensorT<NumList<N>, T>;
 
-    template <int D>
-    class TensorT<NumList<D>> {
+    template <int D, typename T>
+    class alignas(tensorAlignment(sizeof(T) * D)) TensorT<NumList<D>, T> {
         public:
+            typedef T scalar_type;
+
+            static constexpr std::size_t count = D;
 
             TensorT() = default;
-            TensorT(std::initializer_list<float> list);
-            TensorT(float value);
+            constexpr TensorT(std::initializer_list<T> list);
+            constexpr TensorT(T value);
+
+            constexpr T& operator[](std::size_t index);
+            constexpr const T& operator[](std::size_t index) const;
+            constexpr T& getList(std::array<std::size_t, GetSize<NumList<D>>::value> indices);
 
-            float& operator[](std::size_t index);
-            const float& operator[](std::size_t index) const;
-            float& getList(std::array<std::size_t, GetSize<NumList<D>>::value> indices);
+            constexpr T* data();
+            constexpr const T* data() const;
+            constexpr std::span<T, D> span();
+            constexpr std::span<const T, D> span() const;
             
-            float dot(const TensorT& b) const;
-            Vector<D> cross(Vector<D> other) const;
+            // returned in Accumulator<T>, so int8 products or a Half sum do not round or wrap
+            constexpr Accumulator<T> dot(const TensorT& b) const;
+            constexpr Vector<D, T> cross(const Vector<D, T>& other) const;
             
-            float sum() const;
-            float squaredLength() const;
-            float length() const;
+            constexpr Accumulator<T> sum() const;
+            constexpr Accumulator<T> squaredLength() const;
+            T length() const;
 
-            Vector<D> normalize() const;
+            Vector<D, T> normalize() const;
             
-            Vector<D> lerp(Vector<D> to, float t) const;
+            constexpr Vector<D, T> lerp(Vector<D, T> to, T t) const;
 
-            std::size_t size() const;
+            constexpr std::size_t size() const;
             std::string string() const;
-            Vector<D+1> extend(float value) const;
-
-            TENSOR_OPERATION(+, const);
-            TENSOR_OPERATION(-, const);
-            TENSOR_OPERATION(*, const);
-            TENSOR_OPERATION(/, const);
-
-            FLOAT_OPERATION(+, const);
-            FLOAT_OPERATION(-, const);
-            FLOAT_OPERATION(*, const);
-            FLOAT_OPERATION(/, const);
+            constexpr Vector<D+1, T> extend(T value) const;
 
-            TENSOR_OPERATION(+=,);
-            TENSOR_OPERATION(-=,);
-            TENSOR_OPERATION(*=,);
-            TENSOR_OPERATION(/=,);
+            EXPRESSION_EVALUATION
 
-            FLOAT_OPERATION(+=,);
-            FLOAT_OPERATION(-=,);
-            FLOAT_OPERATION(*=,);
-            FLOAT_OPERATION(/=,);
+            COMPOUND_OPERATION(+=, AddOp);
+            COMPOUND_OPERATION(-=, SubOp);
+            COMPOUND_OPERATION(*=, MulOp);
+            COMPOUND_OPERATION(/=, DivOp);
 
         protected:
-            std::array<float, D> data;
+            std::array<T, D> elements;
     };
 
-    FLIPPED_FLOAT_VECTOR_OPERATION(+);
-    FLIPPED_FLOAT_VECTOR_OPERATION(-);
-    FLIPPED_FLOAT_VECTOR_OPERATION(*);
-    FLIPPED_FLOAT_VECTOR_OPERATION(/);
-
+    // named components are accessors rather than members so that
+    // VecN stays exactly N packed floats and trivially copyable
     class Vec2 : public Vector<2> {
         public:
             using Vector<2>::TensorT;
-            Vec2(Vector<2> r) : Vector<2>(r) {}
-            Vec2 operator=(const Vec2& rhs) { 
-                x = rhs.x;
-                y = rhs.y;
-                return *this;
-            }
-
-            float& x = data[0];
-            float& y = data[1];
+            constexpr Vec2(Vector<2> r) : Vector<2>(r) {}
+
+            constexpr float& x() { return elements[0]; }
+            constexpr float& y() { return elements[1]; }
+
+            constexpr const float& x() const { return elements[0]; }
+            constexpr const float& y() const { return elements[1]; }
     };
 
     class Vec3 : public Vector<3> {
         public:
             using Vector<3>::TensorT;
-            Vec3(Vector<3> r) : Vector<3>(r) {}
-            Vec3 operator=(const Vec3& rhs) { 
-                x = rhs.x;
-                y = rhs.y;
-                z = rhs.z;
-                return *this;
-            }
-
-            float& x = data[0];
-            float& y = data[1];
-            float& z = data[2];
+            constexpr Vec3(Vector<3> r) : Vector<3>(r) {}
+
+            constexpr float& x() { return elements[0]; }
+            constexpr float& y() { return elements[1]; }
+            constexpr float& z() { return elements[2]; }
+
+            constexpr const float& x() const { return elements[0]; }
+            constexpr const float& y() const { return elements[1]; }
+            constexpr const float& z() const { return elements[2]; }
     };
 
     class Vec4 : public Vector<4> {
         public:
             using Vector<4>::TensorT;
-            Vec4(Vector<4> r) : Vector<4>(r) {}
-            Vec4 operator=(const Vec4& rhs) { 
-                x = rhs.x;
-                y = rhs.y;
-                z = rhs.z;
-                w = rhs.w;
-                return *this;
-            }
-
-            float& x = data[0];
-            float& y = data[1];
-            float& z = data[2];
-            float& w = data[3];
+            constexpr Vec4(Vector<4> r) : Vector<4>(r) {}
+
+            constexpr float& x() { return elements[0]; }
+            constexpr float& y() { return elements[1]; }
+            constexpr float& z() { return elements[2]; }
+            constexpr float& w() { return elements[3]; }
+
+            constexpr const float& x() const { return elements[0]; }
+            constexpr const float& y() const { return elements[1]; }
+            constexpr const float& z() const { return elements[2]; }
+            constexpr const float& w() const { return elements[3]; }
     };
+
+    static_assert(sizeof(Vec2) == 2 * sizeof(float), "Vec2 must be tightly packed");
+    static_assert(sizeof(Vec3) == 3 * sizeof(float), "Vec3 must be tightly packed");
+    static_assert(sizeof(Vec4) == 4 * sizeof(float), "Vec4 must be tightly packed");
+
+    static_assert(std::is_standard_layout_v<Vec2> && std::is_trivially_copyable_v<Vec2>);
+    static_assert(std::is_standard_layout_v<Vec3> && std::is_trivially_copyable_v<Vec3>);
+    static_assert(std::is_standard_layout_v<Vec4> && std::is_trivially_copyable_v<Vec4>);
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,140 @@
+/**
+ * @file view.hpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Strided views over the storage of a TensorT
+ *
+ * Contains the StridedView class returned by permute and by
+ * the subscript of a tensor of rank 2 or more. A view is an
+ * expression that reads the original tensor through a stride
+ * per dimension, so a permutation costs nothing until it is
+ * assigned to a TensorT, which copies it in tiles. Assigning
+ * to a view writes through to the tensor, like assigning to
+ * a row of it. Views hold a pointer to the tensor they were
+ * taken from, which must outlive them.
+ */
+
+#ifndef LINALG_VIEW_HPP
+#define LINALG_VIEW_HPP
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+#include <linalg/expression.hpp>
+#include <linalg/operations.hpp>
+#include <linalg/simd.hpp>
+#include <linalg/varargs.hpp>
+
+namespace Linalg {
+
+    // square tile walked by the transposing copy, 32 x 32 floats is 4 KiB
+    constexpr std::size_t VIEW_TILE = 32;
+
+    template <typename, typename>
+    class StridedView;
+
+    // strides of a contiguous tensor, dimension 0 varies fastest
+    template <int... D>
+    constexpr std::array<std::size_t, sizeof...(D)> contiguousStrides() {
+        constexpr std::array<std::size_t, sizeof...(D)> dims = {D...};
+        std::array<std::size_t, sizeof...(D)> strides = {};
+        std::size_t stride = 1;
+        for (std::size_t k = 0; k < dims.size(); k++) {
+            strides[k] = stride;
+            stride *= dims[k];
+        }
+        return strides;
+    }
+
+    template <typename T>
+    struct IsStridedView {
+        static constexpr bool value = false;
+    };
+
+    template <typename List, typename T>
+    struct IsStridedView<StridedView<List, T>> {
+        static constexpr bool value = true;
+    };
+
+    // T is const qualified for views of a const tensor
+    template <int... D, typename T>
+    class StridedView<NumList<D...>, T> : public ExpressionBase {
+        public:
+            typedef TensorT<NumList<D...>, std::remove_const_t<T>> value_type;
+
+            typedef std::conditional_t<sizeof...(D) == 1, T&,
+                StridedView<typename PopBack<NumList<D...>>::value, T>> subscript_type;
+
+            static constexpr std::size_t rank = sizeof...(D);
+
+            // element (i0, i1, ...) is data[i0 * strides[0] + i1 * strides[1] + ...]
+            constexpr StridedView(T* data, std::array<std::size_t, sizeof...(D)> strides);
+
+            // copies share the viewed elements
+            constexpr StridedView(const StridedView&) = default;
+
+            // writes the elements of other through to the viewed tensor, views are
+            // references: nothing rebinds them once they are taken
+            constexpr const StridedView& operator=(const StridedView& other) const;
+
+            // writes a tensor, an expression or a scalar of the same shape through to the viewed tensor
+            template <typename E, EnableCompound<E, TensorT<NumList<D...>, std::remove_const_t<T>>> = 0>
+            constexpr const StridedView& operator=(const E& rhs) const;
+
+            // for m[3] = {0, 0, 0, 1}
+            constexpr const StridedView& operator=(const value_type& rhs) const;
+
+            VIEW_COMPOUND_OPERATION(+=, AddOp);
+            VIEW_COMPOUND_OPERATION(-=, SubOp);
+            VIEW_COMPOUND_OPERATION(*=, MulOp);
+            VIEW_COMPOUND_OPERATION(/=, DivOp);
+
+            // like TensorT, the last index is taken first
+            constexpr subscript_type operator[](std::size_t index) const;
+
+            constexpr T& at(std::array<std::size_t, sizeof...(D)> indices) const;
+            Simd::Packet packet(std::size_t index) const;
+
+            static constexpr std::size_t size() { return TensorExtent<value_type>::value; }
+            constexpr std::array<std::size_t, sizeof...(D)> shape() const;
+            constexpr const std::array<std::size_t, sizeof...(D)>& strides() const;
+            constexpr T* data() const;
+
+            // swaps two strides, a view of a view is still a view
+            template <int D1, int D2>
+            StridedView<typename SwapItems<NumList<D...>, D1, D2>::value, T> __permute() const;
+
+            value_type eval() const;
+
+            // writes the elements to out contiguously, out must not overlap the view.
+            // first and last limit the copy to a range of the last index
+            void copyTo(std::remove_const_t<T>* out, std::size_t first = 0, std::size_t last = size()) const;
+
+            // whether writing out one index at a time can overwrite an element of the view
+            // before it is read. out is a tensor or a view of the same shape, one reading the
+            // same elements in the same order does not alias
+            template <typename Out>
+            constexpr bool aliases(const Out& out) const;
+
+        protected:
+            // operator= for a right hand side that reads the viewed elements, kept out of line
+            template <typename E>
+            const StridedView& assignCopy(const E& rhs) const;
+
+            T* elements;
+            std::array<std::size_t, sizeof...(D)> steps;
+    };
+
+    // writes an expression to the contiguous out: a tensor or a view is copied, a flat
+    // expression is one loop and one that reads views goes a row at a time.
+    // out must not be read by the expression, see evaluateCopy
+    template <typename T, typename E>
+    void evaluateTo(T* out, const E& expression);
+
+    // evaluateTo through a copy, for expressions that read the storage of out
+    template <typename T, typename E>
+    void evaluateCopy(T* out, const E& expression);
+}
+
+#endif
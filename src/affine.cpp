@@ -0,0 +1,166 @@
+/**
+ * @file affine.cpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Implementation for the affine transforms
+ */
+
+#include <stdexcept>
+
+#include <linalg/affine.hpp>
+#include <linalg/transform.hpp>
+
+namespace Linalg {
+
+    inline Affine3::Affine3(const Mat3& linear, const Vec3& translation) {
+        Affine3& m = *this;
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) {
+                m[i][j] = linear[i][j];
+            }
+            m[i][3] = translation[i];
+        }
+    }
+
+    inline Affine3::Affine3(const Mat4& matrix) {
+        Affine3& m = *this;
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 4; j++) {
+                m[i][j] = matrix[i][j];
+            }
+        }
+    }
+
+    inline Mat4 Affine3::toMat4() const {
+        const Affine3& m = *this;
+        Mat4 matrix;
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 4; j++) {
+                matrix[i][j] = m[i][j];
+            }
+        }
+        matrix[3] = {0, 0, 0, 1};
+        return matrix;
+    }
+
+    inline Affine3 Affine3::identity() {
+        return Affine3{{1, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, 1, 0}};
+    }
+
+    inline Mat3 Affine3::linear() const {
+        const Affine3& m = *this;
+        Mat3 a;
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) {
+                a[i][j] = m[i][j];
+            }
+        }
+        return a;
+    }
+
+    inline Vec3 Affine3::translation() const {
+        const Affine3& m = *this;
+        return {m[0][3], m[1][3], m[2][3]};
+    }
+
+    inline Affine3 Affine3::operator*(const Affine3& rhs) const {
+        Affine3 result;
+        const float* a = data();
+        const float* b = rhs.data();
+        float* c = result.data();
+
+        // each row of the result is a combination of the rows of rhs plus the translation,
+        // summed locally since the compiler cannot rule out result aliasing rhs
+        for (int i = 0; i < 3; i++) {
+            float row[4];
+            for (int j = 0; j < 4; j++) {
+                row[j] = a[i * 4] * b[j];
+            }
+            for (int k = 1; k < 3; k++) {
+                for (int j = 0; j < 4; j++) {
+                    row[j] += a[i * 4 + k] * b[k * 4 + j];
+                }
+            }
+            for (int j = 0; j < 4; j++) {
+                c[i * 4 + j] = row[j];
+            }
+            c[i * 4 + 3] += a[i * 4 + 3];
+        }
+
+        return result;
+    }
+
+    inline Vec3 Affine3::transformPoint(const Vec3& point) const {
+        const Affine3& m = *this;
+        Vec3 result;
+        for (int i = 0; i < 3; i++) {
+            result[i] = m[i][0] * point[0] + m[i][1] * point[1] + m[i][2] * point[2] + m[i][3];
+        }
+        return result;
+    }
+
+    inline Vec3 Affine3::transformDirection(const Vec3& direction) const {
+        const Affine3& m = *this;
+        Vec3 result;
+        for (int i = 0; i < 3; i++) {
+            result[i] = m[i][0] * direction[0] + m[i][1] * direction[1] + m[i][2] * direction[2];
+        }
+        return result;
+    }
+
+    // the 3x3 cofactors are written out on the rows in place, going
+    // through a Mat3 costs more in copies than the inverse itself
+    inline Affine3 Affine3::inverse() const {
+        const Affine3& m = *this;
+        Affine3 inv;
+
+        inv[0][0] = m[1][1] * m[2][2] - m[1][2] * m[2][1];
+        inv[1][0] = m[1][2] * m[2][0] - m[1][0] * m[2][2];
+        inv[2][0] = m[1][0] * m[2][1] - m[1][1] * m[2][0];
+
+        float det = m[0][0] * inv[0][0] + m[0][1] * inv[1][0] + m[0][2] * inv[2][0];
+        if (det == 0) {
+            throw std::runtime_error("Matrix is singular and cannot be inverted.");
+        }
+        float scale = 1 / det;
+
+        inv[0][1] = m[0][2] * m[2][1] - m[0][1] * m[2][2];
+        inv[1][1] = m[0][0] * m[2][2] - m[0][2] * m[2][0];
+        inv[2][1] = m[0][1] * m[2][0] - m[0][0] * m[2][1];
+        inv[0][2] = m[0][1] * m[1][2] - m[0][2] * m[1][1];
+        inv[1][2] = m[0][2] * m[1][0] - m[0][0] * m[1][2];
+        inv[2][2] = m[0][0] * m[1][1] - m[0][1] * m[1][0];
+
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) {
+                inv[i][j] *= scale;
+            }
+            inv[i][3] = -(inv[i][0] * m[0][3] + inv[i][1] * m[1][3] + inv[i][2] * m[2][3]);
+        }
+
+        return inv;
+    }
+
+    inline Affine3 Affine3::rigidInverse() const {
+        const Affine3& m = *this;
+        Affine3 inv;
+        for (int i = 0; i < 3; i++) {
+            float t = 0;
+            for (int j = 0; j < 3; j++) {
+                inv[i][j] = m[j][i];
+                t -= m[j][i] * m[j][3];
+            }
+            inv[i][3] = t;
+        }
+        return inv;
+    }
+
+    // the batched Mat4 kernels only read the rows they write, so the implicit row costs nothing
+    inline void transformPoints(const Affine3& transform, std::span<const Vec3> in, std::span<Vec3> out) {
+        transformPoints<Vec3>(transform.toMat4(), in, out);
+    }
+
+    inline void transformDirections(const Affine3& transform, std::span<const Vec3> in, std::span<Vec3> out) {
+        transformDirections<Vec3>(transform.toMat4(), in, out);
+    }
+}
@@ -0,0 +1,216 @@
+/**
+ * @file batch.cpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Implementation for the structure of arrays batches
+ */
+
+#include <stdexcept>
+
+#include <linalg/batch.hpp>
+
+namespace Linalg {
+
+    // keeps every component array on its own cache line
+    constexpr std::size_t BATCH_ALIGN = CACHE_LINE / sizeof(float) > Simd::WIDTH
+        ? CACHE_LINE / sizeof(float) : Simd::WIDTH;
+
+    template <int D>
+    VecBatch<D>::VecBatch(std::size_t count) {
+        resize(count);
+    }
+
+    template <int D>
+    template <typename V>
+    VecBatch<D>::VecBatch(std::span<const V> points) {
+        load(points);
+    }
+
+    template <int D>
+    template <typename V>
+    void VecBatch<D>::load(std::span<const V> points) {
+        static_assert(std::is_base_of_v<Vector<D>, V> && sizeof(V) == sizeof(Vector<D>),
+            "Batch elements must be vectors of the same size");
+
+        resize(points.size());
+
+        for (int c = 0; c < D; c++) {
+            float* out = component(c);
+            for (std::size_t i = 0; i < count; i++) {
+                out[i] = points[i][c];
+            }
+        }
+    }
+
+    template <int D>
+    template <typename V>
+    void VecBatch<D>::store(std::span<V> points) const {
+        static_assert(std::is_base_of_v<Vector<D>, V> && sizeof(V) == sizeof(Vector<D>),
+            "Batch elements must be vectors of the same size");
+
+        for (int c = 0; c < D; c++) {
+            const float* in = component(c);
+            for (std::size_t i = 0; i < count && i < points.size(); i++) {
+                points[i][c] = in[i];
+            }
+        }
+    }
+
+    template <int D>
+    std::size_t VecBatch<D>::size() const {
+        return count;
+    }
+
+    template <int D>
+    void VecBatch<D>::resize(std::size_t newCount) {
+        if (newCount == count) {
+            return;
+        }
+
+        count = newCount;
+        stride = (count + BATCH_ALIGN - 1) / BATCH_ALIGN * BATCH_ALIGN;
+        data.assign(stride * D, 0.0f);
+    }
+
+    template <int D>
+    float* VecBatch<D>::component(int index) {
+        return data.data() + index * stride;
+    }
+
+    template <int D>
+    const float* VecBatch<D>::component(int index) const {
+        return data.data() + index * stride;
+    }
+
+    template <int D>
+    Vector<D> VecBatch<D>::operator[](std::size_t index) const {
+        Vector<D> result;
+        for (int c = 0; c < D; c++) {
+            result[c] = component(c)[index];
+        }
+        return result;
+    }
+
+    template <int D>
+    void VecBatch<D>::set(std::size_t index, const Vector<D>& value) {
+        for (int c = 0; c < D; c++) {
+            component(c)[index] = value[c];
+        }
+    }
+
+    template <int D>
+    void VecBatch<D>::dot(const VecBatch& other, std::span<float> out) const {
+        if (other.count != count || out.size() < count) {
+            throw std::invalid_argument("Shapes do not match.");
+        }
+
+        std::size_t packed = count - count % Simd::WIDTH;
+
+        for (std::size_t i = 0; i < packed; i += Simd::WIDTH) {
+            Simd::Packet acc = Simd::mul(Simd::load(component(0) + i), Simd::load(other.component(0) + i));
+            for (int c = 1; c < D; c++) {
+                acc = Simd::fma(Simd::load(component(c) + i), Simd::load(other.component(c) + i), acc);
+            }
+            Simd::store(out.data() + i, acc);
+        }
+
+        for (std::size_t i = packed; i < count; i++) {
+            float acc = 0;
+            for (int c = 0; c < D; c++) {
+                acc += component(c)[i] * other.component(c)[i];
+            }
+            out[i] = acc;
+        }
+    }
+
+    template <int D>
+    void VecBatch<D>::squaredLength(std::span<float> out) const {
+        dot(*this, out);
+    }
+
+    template <int D>
+    void VecBatch<D>::length(std::span<float> out) const {
+        dot(*this, out);
+
+        std::size_t packed = count - count % Simd::WIDTH;
+
+        for (std::size_t i = 0; i < packed; i += Simd::WIDTH) {
+            Simd::store(out.data() + i, Simd::sqrt(Simd::load(out.data() + i)));
+        }
+
+        for (std::size_t i = packed; i < count; i++) {
+            out[i] = std::sqrt(out[i]);
+        }
+    }
+
+    template <int D>
+    void VecBatch<D>::cross(const VecBatch& other, VecBatch& out) const {
+        static_assert(D == 3, "cross product only exits for a vector 3");
+
+        if (other.count != count) {
+            throw std::invalid_argument("Shapes do not match.");
+        }
+
+        out.resize(count);
+
+        const float *ax = component(0), *ay = component(1), *az = component(2);
+        const float *bx = other.component(0), *by = other.component(1), *bz = other.component(2);
+        float *ox = out.component(0), *oy = out.component(1), *oz = out.component(2);
+
+        // the padding is part of every array, so no scalar tail is needed
+        for (std::size_t i = 0; i < stride; i += Simd::WIDTH) {
+            Simd::Packet x1 = Simd::load(ax + i), y1 = Simd::load(ay + i), z1 = Simd::load(az + i);
+            Simd::Packet x2 = Simd::load(bx + i), y2 = Simd::load(by + i), z2 = Simd::load(bz + i);
+
+            Simd::store(ox + i, Simd::sub(Simd::mul(y1, z2), Simd::mul(z1, y2)));
+            Simd::store(oy + i, Simd::sub(Simd::mul(z1, x2), Simd::mul(x1, z2)));
+            Simd::store(oz + i, Simd::sub(Simd::mul(x1, y2), Simd::mul(y1, x2)));
+        }
+    }
+
+    template <int D>
+    void VecBatch<D>::lerp(const VecBatch& to, float t, VecBatch& out) const {
+        if (to.count != count) {
+            throw std::invalid_argument("Shapes do not match.");
+        }
+
+        out.resize(count);
+
+        Simd::Packet from = Simd::broadcast(1 - t);
+        Simd::Packet toward = Simd::broadcast(t);
+
+        for (int c = 0; c < D; c++) {
+            const float* a = component(c);
+            const float* b = to.component(c);
+            float* o = out.component(c);
+
+            for (std::size_t i = 0; i < stride; i += Simd::WIDTH) {
+                Simd::store(o + i, Simd::fma(Simd::load(b + i), toward, Simd::mul(Simd::load(a + i), from)));
+            }
+        }
+    }
+
+    template <int D>
+    void VecBatch<D>::normalize(VecBatch& out) const {
+        out.resize(count);
+
+        for (std::size_t i = 0; i < stride; i += Simd::WIDTH) {
+            Simd::Packet squared = Simd::broadcast(0);
+            for (int c = 0; c < D; c++) {
+                Simd::Packet v = Simd::load(component(c) + i);
+                squared = Simd::fma(v, v, squared);
+            }
+
+            Simd::Packet length = Simd::sqrt(squared);
+            for (int c = 0; c < D; c++) {
+                Simd::store(out.component(c) + i, Simd::div(Simd::load(component(c) + i), length));
+            }
+        }
+    }
+
+    template <int D>
+    VecBatch<D>& VecBatch<D>::normalize() {
+        normalize(*this);
+        return *this;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,108 @@
+/**
+ * @file blas.cpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Implementation for the BLAS/LAPACK backend
+ */
+
+#include <linalg/blas.hpp>
+
+#ifdef LINALG_BLAS
+
+#include <vector>
+
+#include <cblas.h>
+
+// Fortran LAPACK, every argument by pointer and matrices column-major
+extern "C" {
+    void sgetrf_(const int* m, const int* n, float* a, const int* lda, int* ipiv, int* info);
+    void dgetrf_(const int* m, const int* n, double* a, const int* lda, int* ipiv, int* info);
+    void sgetrs_(const char* trans, const int* n, const int* nrhs, const float* a, const int* lda,
+        const int* ipiv, float* b, const int* ldb, int* info);
+    void dgetrs_(const char* trans, const int* n, const int* nrhs, const double* a, const int* lda,
+        const int* ipiv, double* b, const int* ldb, int* info);
+    void sgetri_(const int* n, float* a, const int* lda, const int* ipiv, float* work, const int* lwork, int* info);
+    void dgetri_(const int* n, double* a, const int* lda, const int* ipiv, double* work, const int* lwork, int* info);
+}
+
+namespace Linalg::Blas {
+
+    template <typename T>
+    void gemm(int n, int k, int m, const T* a, const T* b, T* c) {
+        if constexpr (std::is_same_v<T, float>) {
+            cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, n, m, k, 1.0f, a, k, b, m, 0.0f, c, m);
+        } else {
+            cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, n, m, k, 1.0, a, k, b, m, 0.0, c, m);
+        }
+    }
+
+    template <typename T>
+    void gemv(int n, int m, const T* a, const T* x, T* y) {
+        if constexpr (std::is_same_v<T, float>) {
+            cblas_sgemv(CblasRowMajor, CblasNoTrans, n, m, 1.0f, a, m, x, 1, 0.0f, y, 1);
+        } else {
+            cblas_dgemv(CblasRowMajor, CblasNoTrans, n, m, 1.0, a, m, x, 1, 0.0, y, 1);
+        }
+    }
+
+    // a row-major A is a column-major A^T, so this factors A^T = P L U
+    template <typename T>
+    bool getrf(int n, T* a, int* pivots) {
+        int info = 0;
+        if constexpr (std::is_same_v<T, float>) {
+            sgetrf_(&n, &n, a, &n, pivots, &info);
+        } else {
+            dgetrf_(&n, &n, a, &n, pivots, &info);
+        }
+        return info == 0;
+    }
+
+    // the factors are those of A^T, solving with their transpose solves A x = b
+    template <typename T>
+    void getrs(int n, const T* factors, const int* pivots, T* b) {
+        const char trans = 'T';
+        const int nrhs = 1;
+        int info = 0;
+        if constexpr (std::is_same_v<T, float>) {
+            sgetrs_(&trans, &n, &nrhs, factors, &n, pivots, b, &n, &info);
+        } else {
+            dgetrs_(&trans, &n, &nrhs, factors, &n, pivots, b, &n, &info);
+        }
+    }
+
+    // (A^T)^-1 = (A^-1)^T, read back row-major it is A^-1
+    template <typename T>
+    void getri(int n, T* factors, const int* pivots) {
+        int lwork = -1;
+        int info = 0;
+        T query = 0;
+        if constexpr (std::is_same_v<T, float>) {
+            sgetri_(&n, factors, &n, pivots, &query, &lwork, &info);
+        } else {
+            dgetri_(&n, factors, &n, pivots, &query, &lwork, &info);
+        }
+
+        lwork = static_cast<int>(query) > n ? static_cast<int>(query) : n;
+        std::vector<T> work(lwork);
+        if constexpr (std::is_same_v<T, float>) {
+            sgetri_(&n, factors, &n, pivots, work.data(), &lwork, &info);
+        } else {
+            dgetri_(&n, factors, &n, pivots, work.data(), &lwork, &info);
+        }
+    }
+
+    template <typename T>
+    T determinant(int n, const T* factors, const int* pivots) {
+        T det = 1;
+        for (int i = 0; i < n; i++) {
+            det *= factors[i * n + i];
+            // pivots are 1-based, every row that moved flips the sign
+            if (pivots[i] != i + 1) {
+                det = -det;
+            }
+        }
+        return det;
+    }
+}
+
+#endif
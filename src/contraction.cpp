@@ -0,0 +1,86 @@
+/**
+ * @file contraction.cpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Implementation for the tensor contraction
+ */
+
+#include <array>
+
+#include <linalg/contraction.hpp>
+#include <linalg/memory.hpp>
+#include <linalg/view.hpp>
+
+namespace Linalg {
+
+    // strides of a contiguous tensor whose dimensions are named Names, listed in the order of Selected
+    template <typename Names, int... D, int... S>
+    std::array<std::size_t, sizeof...(S)> labelStrides(NumList<D...>, NumList<S...>) {
+        constexpr std::array<std::size_t, sizeof...(D)> dims = {D...};
+        std::array<std::size_t, sizeof...(D)> strides;
+        std::size_t stride = 1;
+        for (std::size_t k = 0; k < dims.size(); k++) {
+            strides[k] = stride;
+            stride *= dims[k];
+        }
+
+        return {strides[IndexOf<Names, S>::value]...};
+    }
+
+    // the elements of tensor with its dimensions in the order of Packed,
+    // copied to buffer unless the tensor is already in that order
+    template <typename Packed, typename Names, int... D, typename T>
+    const T* pack(const TensorT<NumList<D...>, T>& tensor, AlignedVector<T>& buffer) {
+        const T* data = tensor.data();
+
+        if constexpr (std::is_same_v<Packed, Names>) {
+            return data;
+        } else {
+            typedef typename Gather<NumList<D...>, Names, Packed>::value dims;
+            buffer.resize(Product<dims>::value);
+            StridedView<dims, const T>(data, labelStrides<Names>(NumList<D...>{}, Packed{})).copyTo(buffer.data());
+            return buffer.data();
+        }
+    }
+
+    template <typename LA, typename LB, typename LO, int... DA, int... DB, typename T>
+    typename Contraction<LA, LB, LO, NumList<DA...>, NumList<DB...>>::template result<T>
+    contract(const TensorT<NumList<DA...>, T>& a, const TensorT<NumList<DB...>, T>& b) {
+        typedef Contraction<LA, LB, LO, NumList<DA...>, NumList<DB...>> C;
+        constexpr int N = C::N, K = C::K, M = C::M;
+
+        AlignedVector<T> bufferA, bufferB, bufferC;
+        const T* pa = pack<typename C::packedA, LA>(a, bufferA);
+        const T* pb = pack<typename C::packedB, LB>(b, bufferB);
+
+        typename C::template result<T> result;
+
+        // the gemm writes straight into the result when it is already in (freeB, freeA, batch) order
+        constexpr bool scalar = GetSize<LO>::value == 0;
+        constexpr bool direct = scalar || std::is_same_v<typename C::packedC, LO>;
+
+        T* pc;
+        if constexpr (scalar) {
+            pc = &result;
+        } else if constexpr (direct) {
+            pc = result.data();
+        } else {
+            bufferC.resize(static_cast<std::size_t>(N) * M * C::BATCH);
+            pc = bufferC.data();
+        }
+
+        for (int batch = 0; batch < C::BATCH; batch++) {
+            Kernels::gemm<N, K, M>(pa + batch * N * K, pb + batch * K * M, pc + batch * N * M);
+        }
+
+        if constexpr (!direct) {
+            typedef typename Gather<typename C::dims, typename C::labels, typename C::packedC>::value dimsC;
+            typedef typename Gather<typename C::dims, typename C::labels, LO>::value dimsO;
+
+            StridedView<dimsO, const T>(pc, labelStrides<typename C::packedC>(dimsC{}, LO{}))
+                .copyTo(result.data());
+        }
+
+        return result;
+    }
+}
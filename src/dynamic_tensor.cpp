@@ -0,0 +1,280 @@
+/**
+ * @file dynamic_tensor.cpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Implementation for the runtime shaped tensor
+ */
+
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+#include <linalg/dynamic_tensor.hpp>
+#include <linalg/simd.hpp>
+
+namespace Linalg {
+
+    inline std::size_t shapeProduct(const std::vector<std::size_t>& shape) {
+        std::size_t product = 1;
+        for (std::size_t d : shape) {
+            product *= d;
+        }
+        return product;
+    }
+
+    inline DynamicTensor::DynamicTensor(std::vector<std::size_t> shape, std::pmr::memory_resource* resource)
+        : dims(std::move(shape)), resource(resource) {
+        allocate(shapeProduct(dims));
+    }
+
+    inline DynamicTensor::DynamicTensor(std::vector<std::size_t> shape, float value, std::pmr::memory_resource* resource)
+        : DynamicTensor(std::move(shape), resource) {
+        fill(value);
+    }
+
+    template <int... D>
+    DynamicTensor::DynamicTensor(const TensorT<NumList<D...>>& tensor, std::pmr::memory_resource* resource)
+        : DynamicTensor(std::vector<std::size_t>{static_cast<std::size_t>(D)...}, resource) {
+        std::copy(tensor.data(), tensor.data() + count, elements);
+    }
+
+    template <int... D>
+    DynamicTensor DynamicTensor::view(TensorT<NumList<D...>>& tensor) {
+        return view(tensor.data(), std::vector<std::size_t>{static_cast<std::size_t>(D)...});
+    }
+
+    inline DynamicTensor DynamicTensor::view(float* data, std::vector<std::size_t> shape) {
+        DynamicTensor tensor;
+        tensor.dims = std::move(shape);
+        tensor.count = shapeProduct(tensor.dims);
+        tensor.elements = data;
+        return tensor;
+    }
+
+    // copies always own their storage, even when copied from a view
+    inline DynamicTensor::DynamicTensor(const DynamicTensor& other)
+        : dims(other.dims), resource(other.resource ? other.resource : std::pmr::get_default_resource()) {
+        allocate(other.count);
+        std::copy(other.elements, other.elements + count, elements);
+    }
+
+    inline DynamicTensor::DynamicTensor(const DynamicTensor& other, std::pmr::memory_resource* resource)
+        : dims(other.dims), resource(resource) {
+        allocate(other.count);
+        std::copy(other.elements, other.elements + count, elements);
+    }
+
+    inline DynamicTensor::DynamicTensor(DynamicTensor&& other) noexcept
+        : dims(std::move(other.dims)), elements(other.elements), count(other.count), resource(other.resource) {
+        other.elements = nullptr;
+        other.count = 0;
+        other.resource = nullptr;
+    }
+
+    inline DynamicTensor& DynamicTensor::operator=(const DynamicTensor& other) {
+        if (this == &other) {
+            return *this;
+        }
+
+        if (count != other.count) {
+            if (!owning() && elements != nullptr) {
+                throw std::invalid_argument("Cannot resize a view.");
+            }
+            release();
+            if (resource == nullptr) {
+                resource = std::pmr::get_default_resource();
+            }
+            allocate(other.count);
+        }
+
+        dims = other.dims;
+        std::copy(other.elements, other.elements + count, elements);
+        return *this;
+    }
+
+    inline DynamicTensor& DynamicTensor::operator=(DynamicTensor&& other) noexcept {
+        if (this != &other) {
+            release();
+            dims = std::move(other.dims);
+            elements = other.elements;
+            count = other.count;
+            resource = other.resource;
+            other.elements = nullptr;
+            other.count = 0;
+            other.resource = nullptr;
+        }
+        return *this;
+    }
+
+    inline DynamicTensor::~DynamicTensor() {
+        release();
+    }
+
+    // whole cache lines, so that as() can hand out a padded TensorT
+    inline std::size_t storageBytes(std::size_t count) {
+        return (count * sizeof(float) + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE;
+    }
+
+    inline void DynamicTensor::allocate(std::size_t newCount) {
+        count = newCount;
+        elements = count > 0
+            ? static_cast<float*>(resource->allocate(storageBytes(count), CACHE_LINE))
+            : nullptr;
+    }
+
+    inline void DynamicTensor::release() {
+        if (owning() && elements != nullptr) {
+            resource->deallocate(elements, storageBytes(count), CACHE_LINE);
+        }
+        elements = nullptr;
+        count = 0;
+    }
+
+    inline std::size_t DynamicTensor::size() const {
+        return count;
+    }
+
+    inline std::size_t DynamicTensor::rank() const {
+        return dims.size();
+    }
+
+    inline const std::vector<std::size_t>& DynamicTensor::shape() const {
+        return dims;
+    }
+
+    inline bool DynamicTensor::owning() const {
+        return resource != nullptr;
+    }
+
+    inline float* DynamicTensor::data() {
+        return elements;
+    }
+
+    inline const float* DynamicTensor::data() const {
+        return elements;
+    }
+
+    inline std::span<float> DynamicTensor::span() {
+        return {elements, count};
+    }
+
+    inline std::span<const float> DynamicTensor::span() const {
+        return {elements, count};
+    }
+
+    inline float& DynamicTensor::at(std::initializer_list<std::size_t> indices) {
+        return const_cast<float&>(static_cast<const DynamicTensor&>(*this).at(indices));
+    }
+
+    inline const float& DynamicTensor::at(std::initializer_list<std::size_t> indices) const {
+        if (indices.size() != dims.size()) {
+            throw std::invalid_argument("Wrong number of indices.");
+        }
+
+        std::size_t offset = 0;
+        std::size_t stride = 1;
+        std::size_t d = 0;
+        for (std::size_t index : indices) {
+            if (index >= dims[d]) {
+                throw std::out_of_range("Tensor index out of range.");
+            }
+            offset += index * stride;
+            stride *= dims[d++];
+        }
+
+        return elements[offset];
+    }
+
+    template <int... D>
+    TensorT<NumList<D...>>& DynamicTensor::as() {
+        if (dims != std::vector<std::size_t>{static_cast<std::size_t>(D)...}) {
+            throw std::invalid_argument("Shapes do not match.");
+        }
+        // owned buffers are whole cache lines, a view may end before the padding of the tensor
+        if (!owning() && sizeof(TensorT<NumList<D...>>) > count * sizeof(float)) {
+            throw std::invalid_argument("Buffer is too small for the padded tensor.");
+        }
+        // views of arbitrary pointers may start below the alignment of the tensor
+        if (reinterpret_cast<std::uintptr_t>(elements) % alignof(TensorT<NumList<D...>>) != 0) {
+            throw std::invalid_argument("Buffer is not aligned for the tensor.");
+        }
+
+        return *reinterpret_cast<TensorT<NumList<D...>>*>(elements);
+    }
+
+    inline void DynamicTensor::fill(float value) {
+        std::fill(elements, elements + count, value);
+    }
+
+    inline void DynamicTensor::reshape(std::vector<std::size_t> shape) {
+        if (shapeProduct(shape) != count) {
+            throw std::invalid_argument("Reshape must keep the number of elements.");
+        }
+        dims = std::move(shape);
+    }
+
+    inline void DynamicTensor::checkShape(const DynamicTensor& other) const {
+        if (dims != other.dims) {
+            throw std::invalid_argument("Shapes do not match.");
+        }
+    }
+
+    template <typename Op>
+    void DynamicTensor::apply(const float* rhs, float* out) const {
+        std::size_t packed = count - count % Simd::WIDTH;
+
+        for (std::size_t i = 0; i < packed; i += Simd::WIDTH) {
+            Simd::store(out + i, Op::apply(Simd::load(elements + i), Simd::load(rhs + i)));
+        }
+
+        for (std::size_t i = packed; i < count; i++) {
+            out[i] = Op::apply(elements[i], rhs[i]);
+        }
+    }
+
+    template <typename Op>
+    void DynamicTensor::apply(float rhs, float* out) const {
+        std::size_t packed = count - count % Simd::WIDTH;
+        Simd::Packet scalar = Simd::broadcast(rhs);
+
+        for (std::size_t i = 0; i < packed; i += Simd::WIDTH) {
+            Simd::store(out + i, Op::apply(Simd::load(elements + i), scalar));
+        }
+
+        for (std::size_t i = packed; i < count; i++) {
+            out[i] = Op::apply(elements[i], rhs);
+        }
+    }
+
+#define DYNAMIC_TENSOR_OPERATION(op, functor)                                                      \
+    inline DynamicTensor DynamicTensor::operator op(const DynamicTensor& rhs) const {              \
+        checkShape(rhs);                                                                           \
+        DynamicTensor result(dims, resource ? resource : std::pmr::get_default_resource());        \
+        apply<functor>(rhs.elements, result.elements);                                             \
+        return result;                                                                             \
+    }                                                                                              \
+                                                                                                   \
+    inline DynamicTensor DynamicTensor::operator op(float rhs) const {                             \
+        DynamicTensor result(dims, resource ? resource : std::pmr::get_default_resource());        \
+        apply<functor>(rhs, result.elements);                                                      \
+        return result;                                                                             \
+    }                                                                                              \
+                                                                                                   \
+    inline DynamicTensor& DynamicTensor::operator op##=(const DynamicTensor& rhs) {                \
+        checkShape(rhs);                                                                           \
+        apply<functor>(rhs.elements, elements);                                                    \
+        return *this;                                                                              \
+    }                                                                                              \
+                                                                                                   \
+    inline DynamicTensor& DynamicTensor::operator op##=(float rhs) {                               \
+        apply<functor>(rhs, elements);                                                             \
+        return *this;                                                                              \
+    }
+
+    DYNAMIC_TENSOR_OPERATION(+, AddOp)
+    DYNAMIC_TENSOR_OPERATION(-, SubOp)
+    DYNAMIC_TENSOR_OPERATION(*, MulOp)
+    DYNAMIC_TENSOR_OPERATION(/, DivOp)
+
+#undef DYNAMIC_TENSOR_OPERATION
+}
\ No newline at end of file
@@ -0,0 +1,141 @@
+/**
+ * @file execution.cpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Implementation for the parallel tensor operations
+ */
+
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <linalg/execution.hpp>
+#include <linalg/simd.hpp>
+
+namespace Linalg {
+
+    template <typename Policy, std::size_t Count>
+    constexpr bool runsParallel() {
+        static_assert(std::is_same_v<Policy, Sequenced> || std::is_same_v<Policy, Parallel>,
+            "Policy must be seq or par");
+
+        return std::is_same_v<Policy, Parallel> && Count >= PARALLEL_THRESHOLD;
+    }
+
+    template <typename Policy, int... D, typename T, typename E>
+    void assign(const Policy& policy, TensorT<NumList<D...>, T>& out, const E& expression) {
+        typedef TensorT<NumList<D...>, T> Tensor;
+        static_assert(IsExpression<E>::value, "assign evaluates an expression or a view");
+        static_assert(std::is_same_v<typename E::value_type, Tensor>, "Shapes do not match.");
+
+        constexpr std::size_t count = (static_cast<std::size_t>(D) * ...);
+
+        if constexpr (!runsParallel<Policy, count>()) {
+            out = expression;
+        } else {
+            // each chunk of outer indices holds at least PARALLEL_THRESHOLD / 4 elements
+            constexpr std::size_t outer = TensorExtent<Tensor>::value;
+            constexpr std::size_t inner = count / outer;
+            constexpr std::size_t grain = inner >= PARALLEL_THRESHOLD / 4 ? 1 : PARALLEL_THRESHOLD / 4 / inner;
+
+            // chunks overwrite what the others may still read when a view in the
+            // expression aliases out, t = t.permute(0, 1) + t goes through a copy
+            if (expression.aliases(out)) {
+                auto copy = std::make_unique<Tensor>();
+                assign(policy, *copy, expression);
+                out = *copy;
+                return;
+            }
+
+            T* dst = out.data();
+            if constexpr (IsStridedView<E>::value) {
+                policy.threads().parallelFor(0, outer, grain, [&](std::size_t first, std::size_t last) {
+                    expression.copyTo(dst, first, last);
+                });
+            } else if constexpr (sizeof...(D) == 1) {
+                policy.threads().parallelFor(0, outer, grain, [&](std::size_t first, std::size_t last) {
+                    evaluate(dst, expression, first, last);
+                });
+            } else if constexpr (IsFlat<E>::value) {
+                policy.threads().parallelFor(0, count, PARALLEL_THRESHOLD / 4, [&](std::size_t first, std::size_t last) {
+                    evaluateFlat(dst, expression, first, last);
+                });
+            } else {
+                policy.threads().parallelFor(0, outer, grain, [&](std::size_t first, std::size_t last) {
+                    for (std::size_t i = first; i < last; i++) {
+                        evaluateRows(dst + i * inner, expression[i]);
+                    }
+                });
+            }
+        }
+    }
+
+    // f(first, last) over [0, count), in PARALLEL_THRESHOLD sized chunks when running in parallel.
+    // T is the accumulator, Accumulator<E> for elements E
+    template <typename Policy, std::size_t Count, typename T, typename F>
+    T reduce(const Policy& policy, F&& partial) {
+        if constexpr (!runsParallel<Policy, Count>()) {
+            return partial(0, Count);
+        } else {
+            constexpr std::size_t chunks = (Count + PARALLEL_THRESHOLD - 1) / PARALLEL_THRESHOLD;
+            std::vector<T> partials(chunks);
+
+            policy.threads().parallelFor(0, chunks, 1, [&](std::size_t first, std::size_t last) {
+                for (std::size_t c = first; c < last; c++) {
+                    std::size_t end = (c + 1) * PARALLEL_THRESHOLD;
+                    partials[c] = partial(c * PARALLEL_THRESHOLD, end < Count ? end : Count);
+                }
+            });
+
+            // compensated so that adding many large chunks keeps the accuracy of each
+            T total = 0;
+            T compensation = 0;
+            for (T value : partials) {
+                T y = value - compensation;
+                T t = total + y;
+                compensation = (t - total) - y;
+                total = t;
+            }
+            return total;
+        }
+    }
+
+    template <typename Policy, int... D, typename T>
+    Accumulator<T> sum(const Policy& policy, const TensorT<NumList<D...>, T>& tensor) {
+        typedef Accumulator<T> A;
+        constexpr std::size_t count = (static_cast<std::size_t>(D) * ...);
+        const T* data = tensor.data();
+
+        return reduce<Policy, count, A>(policy, [data](std::size_t first, std::size_t last) -> A {
+            if constexpr (std::is_same_v<T, float>) {
+                return Simd::sum(data + first, last - first);
+            } else {
+                A total = 0;
+                for (std::size_t i = first; i < last; i++) {
+                    total += data[i];
+                }
+                return total;
+            }
+        });
+    }
+
+    template <typename Policy, int... D, typename T>
+    Accumulator<T> dot(const Policy& policy, const TensorT<NumList<D...>, T>& a, const TensorT<NumList<D...>, T>& b) {
+        typedef Accumulator<T> A;
+        constexpr std::size_t count = (static_cast<std::size_t>(D) * ...);
+        const T* pa = a.data();
+        const T* pb = b.data();
+
+        return reduce<Policy, count, A>(policy, [pa, pb](std::size_t first, std::size_t last) -> A {
+            if constexpr (std::is_same_v<T, float>) {
+                return Simd::dot(pa + first, pb + first, last - first);
+            } else {
+                A total = 0;
+                for (std::size_t i = first; i < last; i++) {
+                    total += static_cast<A>(pa[i]) * static_cast<A>(pb[i]);
+                }
+                return total;
+            }
+        });
+    }
+}
@@ -0,0 +1,206 @@
+/**
+ * @file format.cpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Implementation for the tensor text formatting
+ */
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+
+#include <linalg/format.hpp>
+
+namespace Linalg {
+
+    // a double in fixed notation needs up to 311 chars before the precision digits,
+    // elements that still do not fit fall back to the shortest form
+    constexpr std::size_t FORMAT_ELEMENT_CHARS = 512;
+
+    // chars gathered before a stream write
+    constexpr std::size_t FORMAT_STREAM_BUFFER = 4096;
+
+    template <typename T>
+    std::to_chars_result formatElement(char* first, char* last, T element, int precision) {
+        // unary plus prints int8_t as a number and Half as a float
+        auto value = +element;
+
+        if constexpr (std::is_floating_point_v<decltype(value)>) {
+            if (precision != SHORTEST) {
+                std::to_chars_result written = std::to_chars(first, last, value, std::chars_format::fixed, precision);
+                if (written.ec != std::errc::value_too_large) {
+                    return written;
+                }
+            }
+            return std::to_chars(first, last, value);
+        } else {
+            return std::to_chars(first, last, value);
+        }
+    }
+
+    // walks the elements in storage order and hands the text to sink in pieces,
+    // sink returns false to stop when its output is full
+    template <int... D, typename T, typename Sink>
+    bool formatTo(const TensorT<NumList<D...>, T>& tensor, const FormatOptions& options, Sink&& sink) {
+        constexpr std::size_t rank = sizeof...(D);
+        constexpr std::size_t count = (static_cast<std::size_t>(D) * ...);
+
+        // extents[k] is the number of elements in one group of dimension k
+        constexpr std::array<std::size_t, rank> dims = {D...};
+        std::array<std::size_t, rank> extents;
+        std::size_t extent = 1;
+        for (std::size_t k = 0; k < rank; k++) {
+            extent *= dims[k];
+            extents[k] = extent;
+        }
+
+        const T* data = tensor.data();
+        std::size_t separatorLength = std::strlen(options.separator);
+        char element[FORMAT_ELEMENT_CHARS];
+
+        for (std::size_t i = 0; i < count; i++) {
+            if (options.brackets) {
+                for (std::size_t k = 0; k < rank; k++) {
+                    if (i % extents[rank - 1 - k] == 0 && !sink("(", 1)) {
+                        return false;
+                    }
+                }
+            }
+
+            std::to_chars_result written = formatElement(element, element + FORMAT_ELEMENT_CHARS, data[i], options.precision);
+            if (written.ec != std::errc() || !sink(element, written.ptr - element)) {
+                return false;
+            }
+
+            std::size_t closed = 0;
+            while (closed < rank && (i + 1) % extents[closed] == 0) {
+                closed++;
+            }
+
+            if (options.brackets) {
+                for (std::size_t k = 0; k < closed; k++) {
+                    if (!sink(")", 1)) {
+                        return false;
+                    }
+                }
+                if (i + 1 < count && !sink(options.separator, separatorLength)) {
+                    return false;
+                }
+            } else if (i + 1 < count) {
+                bool sent = closed > 0 ? sink("\n", 1) : sink(options.separator, separatorLength);
+                if (!sent) {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    template <int... D, typename T>
+    std::to_chars_result format(char* first, char* last, const TensorT<NumList<D...>, T>& tensor,
+        const FormatOptions& options) {
+        char* out = first;
+
+        bool fits = formatTo(tensor, options, [&](const char* text, std::size_t length) {
+            if (static_cast<std::size_t>(last - out) < length) {
+                return false;
+            }
+            std::memcpy(out, text, length);
+            out += length;
+            return true;
+        });
+
+        if (!fits) {
+            return {last, std::errc::value_too_large};
+        }
+        return {out, std::errc()};
+    }
+
+    template <int... D, typename T>
+    void format(std::ostream& stream, const TensorT<NumList<D...>, T>& tensor, const FormatOptions& options) {
+        char buffer[FORMAT_STREAM_BUFFER];
+        std::size_t used = 0;
+
+        bool complete = formatTo(tensor, options, [&](const char* text, std::size_t length) {
+            if (FORMAT_STREAM_BUFFER - used < length) {
+                stream.write(buffer, used);
+                used = 0;
+            }
+            std::memcpy(buffer + used, text, length);
+            used += length;
+            return true;
+        });
+
+        stream.write(buffer, used);
+        if (!complete) {
+            stream.setstate(std::ios::failbit);
+        }
+    }
+
+    template <int... D, typename T>
+    std::string toString(const TensorT<NumList<D...>, T>& tensor, const FormatOptions& options) {
+        std::string text;
+        bool complete = formatTo(tensor, options, [&](const char* chars, std::size_t length) {
+            text.append(chars, length);
+            return true;
+        });
+
+        if (!complete) {
+            throw std::runtime_error("Element could not be formatted.");
+        }
+        return text;
+    }
+
+    inline bool isFormatSeparator(char c) {
+        return c == '(' || c == ')' || c == '[' || c == ']' || c == ',' || c == ';' ||
+            c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+
+    template <int... D, typename T>
+    std::from_chars_result parse(const char* first, const char* last, TensorT<NumList<D...>, T>& tensor) {
+        constexpr std::size_t count = (static_cast<std::size_t>(D) * ...);
+
+        // Half and BFloat16 are read as float, int8_t as int
+        typedef decltype(+std::declval<T>()) Parsed;
+
+        T* data = tensor.data();
+        const char* p = first;
+
+        for (std::size_t i = 0; i < count; i++) {
+            while (p < last && isFormatSeparator(*p)) {
+                p++;
+            }
+
+            Parsed value;
+            std::from_chars_result read = std::from_chars(p, last, value);
+            if (read.ec != std::errc()) {
+                return {p, read.ec};
+            }
+
+            // int8_t or Half take a narrower range than the value they are read as
+            if constexpr (std::is_integral_v<T>) {
+                if (value < std::numeric_limits<T>::min() || value > std::numeric_limits<T>::max()) {
+                    return {p, std::errc::result_out_of_range};
+                }
+            } else if constexpr (!std::is_same_v<T, Parsed>) {
+                if (std::isfinite(value) && !std::isfinite(static_cast<Parsed>(static_cast<T>(value)))) {
+                    return {p, std::errc::result_out_of_range};
+                }
+            }
+
+            data[i] = static_cast<T>(value);
+            p = read.ptr;
+        }
+
+        // the closing brackets belong to the tensor
+        while (p < last && (*p == ')' || *p == ']')) {
+            p++;
+        }
+
+        return {p, std::errc()};
+    }
+}
@@ -0,0 +1,104 @@
+/**
+ * @file gemm.cpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Implementation for the matrix multiplication kernels
+ */
+
+#include <linalg/gemm.hpp>
+
+namespace Linalg::Kernels {
+
+    template <int N, int K, int M, typename T>
+    void gemmNaive(const T* a, const T* b, T* c) {
+        for (int i = 0; i < N; i++) {
+            for (int j = 0; j < M; j++) {
+                c[i * M + j] = 0;
+            }
+
+            for (int p = 0; p < K; p++) {
+                T aip = a[i * K + p];
+                for (int j = 0; j < M; j++) {
+                    c[i * M + j] += aip * b[p * M + j];
+                }
+            }
+        }
+    }
+
+    // full MR x NR tile, accumulators stay in registers for the whole k sweep
+    template <int K, int M, typename T>
+    inline void gemmTile(const T* a, const T* b, T* c, int kc) {
+        T acc[GEMM_MR][GEMM_NR] = {};
+
+        for (int p = 0; p < kc; p++) {
+            const T* bRow = b + p * M;
+            for (int r = 0; r < GEMM_MR; r++) {
+                T arp = a[r * K + p];
+                for (int j = 0; j < GEMM_NR; j++) {
+                    acc[r][j] += arp * bRow[j];
+                }
+            }
+        }
+
+        for (int r = 0; r < GEMM_MR; r++) {
+            for (int j = 0; j < GEMM_NR; j++) {
+                c[r * M + j] += acc[r][j];
+            }
+        }
+    }
+
+    // partial tile on the right or bottom edge
+    template <int K, int M, typename T>
+    inline void gemmEdge(const T* a, const T* b, T* c, int mr, int nr, int kc) {
+        for (int r = 0; r < mr; r++) {
+            for (int p = 0; p < kc; p++) {
+                T arp = a[r * K + p];
+                for (int j = 0; j < nr; j++) {
+                    c[r * M + j] += arp * b[p * M + j];
+                }
+            }
+        }
+    }
+
+    template <int N, int K, int M, typename T>
+    void gemm(const T* a, const T* b, T* c) {
+        if constexpr (N < GEMM_MR || M < GEMM_NR || (long)N * K * M <= 16 * 16 * 16) {
+            gemmNaive<N, K, M, T>(a, b, c);
+            return;
+        }
+
+        for (int i = 0; i < N * M; i++) {
+            c[i] = 0;
+        }
+
+        for (int jc = 0; jc < M; jc += GEMM_NC) {
+            int nc = M - jc < GEMM_NC ? M - jc : GEMM_NC;
+
+            for (int pc = 0; pc < K; pc += GEMM_KC) {
+                int kc = K - pc < GEMM_KC ? K - pc : GEMM_KC;
+
+                for (int ic = 0; ic < N; ic += GEMM_MC) {
+                    int mc = N - ic < GEMM_MC ? N - ic : GEMM_MC;
+
+                    for (int jr = 0; jr < nc; jr += GEMM_NR) {
+                        int nr = nc - jr < GEMM_NR ? nc - jr : GEMM_NR;
+
+                        for (int ir = 0; ir < mc; ir += GEMM_MR) {
+                            int mr = mc - ir < GEMM_MR ? mc - ir : GEMM_MR;
+
+                            const T* aBlock = a + (ic + ir) * K + pc;
+                            const T* bBlock = b + pc * M + jc + jr;
+                            T* cBlock = c + (ic + ir) * M + jc + jr;
+
+                            if (mr == GEMM_MR && nr == GEMM_NR) {
+                                gemmTile<K, M, T>(aBlock, bBlock, cBlock, kc);
+                            } else {
+                                gemmEdge<K, M, T>(aBlock, bBlock, cBlock, mr, nr, kc);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -5,6 +5,27 @@
  * @brief Link to all source files
  */
 
+#include "affine.cpp"
+#include "batch.cpp"
+#include "blas.cpp"
+#include "contraction.cpp"
+#include "dynamic_tensor.cpp"
+#include "execution.cpp"
+#include "format.cpp"
+#include "gemm.cpp"
+#include "lu.cpp"
 #include "matrix.cpp"
+#include "memory.cpp"
+#include "preconditioner.cpp"
+#include "quaternion.cpp"
+#include "reduction.cpp"
+#include "scalar.cpp"
+#include "simd.cpp"
+#include "solver.cpp"
+#include "sparse.cpp"
 #include "tensor.cpp"
-#include "vector.cpp"
\ No newline at end of file
+#include "tensor_file.cpp"
+#include "thread_pool.cpp"
+#include "transform.cpp"
+#include "vector.cpp"
+#include "view.cpp"
\ No newline at end of file
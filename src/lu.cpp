@@ -0,0 +1,123 @@
+/**
+ * @file lu.cpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Implementation for the LU decomposition
+ */
+
+#include <algorithm>
+
+#include <linalg/lu.hpp>
+
+namespace Linalg {
+
+    template <int N, typename T>
+    constexpr LU<N, T>::LU(const Matrix<N, N, T>& matrix) : factors(matrix) {
+        for (int i = 0; i < N; i++) {
+            pivots[i] = i;
+        }
+
+        // row-major, the elimination indexes the buffer rather than going through row views
+        T* a = factors.data();
+
+        for (int k = 0; k < N; k++) {
+            int pivot = k;
+            // std::abs is not constexpr before C++23
+            T largest = a[k * N + k] < 0 ? -a[k * N + k] : a[k * N + k];
+            for (int i = k + 1; i < N; i++) {
+                T magnitude = a[i * N + k] < 0 ? -a[i * N + k] : a[i * N + k];
+                if (magnitude > largest) {
+                    largest = magnitude;
+                    pivot = i;
+                }
+            }
+
+            if (largest == 0) {
+                isSingular = true;
+                continue;
+            }
+
+            if (pivot != k) {
+                std::swap_ranges(a + k * N, a + (k + 1) * N, a + pivot * N);
+                std::swap(pivots[k], pivots[pivot]);
+                sign = -sign;
+            }
+
+            T inv = 1 / a[k * N + k];
+            for (int i = k + 1; i < N; i++) {
+                T l = a[i * N + k] * inv;
+                a[i * N + k] = l;
+                for (int j = k + 1; j < N; j++) {
+                    a[i * N + j] -= l * a[k * N + j];
+                }
+            }
+        }
+    }
+
+    template <int N, typename T>
+    constexpr bool LU<N, T>::singular() const {
+        return isSingular;
+    }
+
+    template <int N, typename T>
+    constexpr T LU<N, T>::determinant() const {
+        if (isSingular) {
+            return 0;
+        }
+
+        T det = sign;
+        for (int i = 0; i < N; i++) {
+            det *= factors[i][i];
+        }
+
+        return det;
+    }
+
+    template <int N, typename T>
+    constexpr Vector<N, T> LU<N, T>::solve(const Vector<N, T>& b) const {
+        if (isSingular) {
+            throw std::runtime_error("Matrix is singular and cannot be solved.");
+        }
+
+        Vector<N, T> x;
+
+        for (int i = 0; i < N; i++) {
+            T sum = b[pivots[i]];
+            for (int j = 0; j < i; j++) {
+                sum -= factors[i][j] * x[j];
+            }
+            x[i] = sum;
+        }
+
+        for (int i = N - 1; i >= 0; i--) {
+            T sum = x[i];
+            for (int j = i + 1; j < N; j++) {
+                sum -= factors[i][j] * x[j];
+            }
+            x[i] = sum / factors[i][i];
+        }
+
+        return x;
+    }
+
+    template <int N, typename T>
+    constexpr Matrix<N, N, T> LU<N, T>::inverse() const {
+        if (isSingular) {
+            throw std::runtime_error("Matrix is singular and cannot be inverted.");
+        }
+
+        Matrix<N, N, T> inv;
+
+        for (int j = 0; j < N; j++) {
+            Vector<N, T> e = 0;
+            e[j] = 1;
+
+            Vector<N, T> column = solve(e);
+            for (int i = 0; i < N; i++) {
+                inv[i][j] = column[i];
+            }
+        }
+
+        return inv;
+    }
+}
\ No newline at end of file
@@ -5,97 +5,286 @@
  * @brief Implementation for Matrix functions
  */
 
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <type_traits>
+
+#include <linalg/blas.hpp>
+#include <linalg/lu.hpp>
 #include <linalg/matrix.hpp>
+#include <linalg/simd.hpp>
 
 namespace Linalg {
 
-    template <int N, int V>
-    Matrix<V, N> Matrix<N, V>::transpose() const {
+    // closed-form adjugate of a row-major N x N matrix for N = 2, 3, 4, returns the determinant
+    template <int N, typename T>
+    constexpr T closedAdjugate(const T* m, T* out) {
+        if constexpr (N == 2) {
+            out[0] = m[3];
+            out[1] = -m[1];
+            out[2] = -m[2];
+            out[3] = m[0];
+            return m[0] * m[3] - m[1] * m[2];
+        } else if constexpr (N == 3) {
+            out[0] = m[4] * m[8] - m[5] * m[7];
+            out[3] = m[5] * m[6] - m[3] * m[8];
+            out[6] = m[3] * m[7] - m[4] * m[6];
+            out[1] = m[2] * m[7] - m[1] * m[8];
+            out[4] = m[0] * m[8] - m[2] * m[6];
+            out[7] = m[1] * m[6] - m[0] * m[7];
+            out[2] = m[1] * m[5] - m[2] * m[4];
+            out[5] = m[2] * m[3] - m[0] * m[5];
+            out[8] = m[0] * m[4] - m[1] * m[3];
+            return m[0] * out[0] + m[1] * out[3] + m[2] * out[6];
+        } else {
+            static_assert(N == 4, "Closed-form adjugates are only written out up to 4x4");
+
+#if !defined(LINALG_NO_SIMD) && defined(__SSE2__)
+            if constexpr (std::is_same_v<T, float>) {
+                if (!std::is_constant_evaluated()) {
+                    return Simd::adjugate4(m, out);
+                }
+            }
+#endif
+
+            // 2x2 sub-determinants of the top two rows (s) and the bottom two rows (c)
+            T s0 = m[0] * m[5] - m[4] * m[1];
+            T s1 = m[0] * m[6] - m[4] * m[2];
+            T s2 = m[0] * m[7] - m[4] * m[3];
+            T s3 = m[1] * m[6] - m[5] * m[2];
+            T s4 = m[1] * m[7] - m[5] * m[3];
+            T s5 = m[2] * m[7] - m[6] * m[3];
+
+            T c5 = m[10] * m[15] - m[14] * m[11];
+            T c4 = m[9] * m[15] - m[13] * m[11];
+            T c3 = m[9] * m[14] - m[13] * m[10];
+            T c2 = m[8] * m[15] - m[12] * m[11];
+            T c1 = m[8] * m[14] - m[12] * m[10];
+            T c0 = m[8] * m[13] - m[12] * m[9];
+
+            out[0] = m[5] * c5 - m[6] * c4 + m[7] * c3;
+            out[1] = -m[1] * c5 + m[2] * c4 - m[3] * c3;
+            out[2] = m[13] * s5 - m[14] * s4 + m[15] * s3;
+            out[3] = -m[9] * s5 + m[10] * s4 - m[11] * s3;
+            out[4] = -m[4] * c5 + m[6] * c2 - m[7] * c1;
+            out[5] = m[0] * c5 - m[2] * c2 + m[3] * c1;
+            out[6] = -m[12] * s5 + m[14] * s2 - m[15] * s1;
+            out[7] = m[8] * s5 - m[10] * s2 + m[11] * s1;
+            out[8] = m[4] * c4 - m[5] * c2 + m[7] * c0;
+            out[9] = -m[0] * c4 + m[1] * c2 - m[3] * c0;
+            out[10] = m[12] * s4 - m[13] * s2 + m[15] * s0;
+            out[11] = -m[8] * s4 + m[9] * s2 - m[11] * s0;
+            out[12] = -m[4] * c3 + m[5] * c1 - m[6] * c0;
+            out[13] = m[0] * c3 - m[1] * c1 + m[2] * c0;
+            out[14] = -m[12] * s3 + m[13] * s1 - m[14] * s0;
+            out[15] = m[8] * s3 - m[9] * s1 + m[10] * s0;
+
+            return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+        }
+    }
+
+    template <int N, typename T>
+    constexpr T closedDeterminant(const T* m) {
+        if constexpr (N == 2) {
+            return m[0] * m[3] - m[1] * m[2];
+        } else if constexpr (N == 3) {
+            return m[0] * (m[4] * m[8] - m[5] * m[7])
+                - m[1] * (m[3] * m[8] - m[5] * m[6])
+                + m[2] * (m[3] * m[7] - m[4] * m[6]);
+        } else {
+            T s0 = m[0] * m[5] - m[4] * m[1];
+            T s1 = m[0] * m[6] - m[4] * m[2];
+            T s2 = m[0] * m[7] - m[4] * m[3];
+            T s3 = m[1] * m[6] - m[5] * m[2];
+            T s4 = m[1] * m[7] - m[5] * m[3];
+            T s5 = m[2] * m[7] - m[6] * m[3];
+
+            T c5 = m[10] * m[15] - m[14] * m[11];
+            T c4 = m[9] * m[15] - m[13] * m[11];
+            T c3 = m[9] * m[14] - m[13] * m[10];
+            T c2 = m[8] * m[15] - m[12] * m[11];
+            T c1 = m[8] * m[14] - m[12] * m[10];
+            T c0 = m[8] * m[13] - m[12] * m[9];
+
+            return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+        }
+    }
+
+    template <int N, int V, typename T>
+    constexpr Matrix<V, N, T> Matrix<N, V, T>::transpose() const {
+        if (std::is_constant_evaluated()) {
+            Matrix<V, N, T> result;
+            for (int i = 0; i < N; i++) {
+                for (int j = 0; j < V; j++) {
+                    result.elements[j * N + i] = this->elements[i * V + j];
+                }
+            }
+            return result;
+        }
+
         return this->template __permute<0, 1>();
     }
 
-    template <int N, int V>
-    float Matrix<N, V>::determinant() const {
+    template <int N, int V, typename T>
+    constexpr LU<N, T> Matrix<N, V, T>::lu() const {
+        static_assert(N == V, "LU decomposition only defined for square matrices");
+
+        return LU<N, T>(*this);
+    }
+
+    template <int N, int V, typename T>
+    constexpr T Matrix<N, V, T>::determinant() const {
         static_assert(N == V, "Determinant only defined for square matrices");
 
-        if constexpr (N == 1) {
-            return this->data[0][0];
+        if constexpr (N >= 2 && N <= 4) {
+            return closedDeterminant<N>(this->data());
+        } else {
+            if constexpr (Blas::routed<N, T>) {
+                if (!std::is_constant_evaluated()) {
+                    Matrix<N, V, T> factors = *this;
+                    std::array<int, N> pivots;
+                    if (!Blas::getrf(N, factors.data(), pivots.data())) {
+                        return 0;
+                    }
+                    return Blas::determinant(N, factors.data(), pivots.data());
+                }
+            }
+
+            return lu().determinant();
         }
+    }
 
-        float det = 0;
-        int sign = 1;
+    template <int N, int V, typename T>
+    constexpr Vector<N, T> Matrix<N, V, T>::solve(const Vector<N, T>& b) const {
+        static_assert(N == V, "Solve only defined for square matrices");
 
-        for (int f = 0; f < N; f++) {
-            Matrix<N-1, N-1> temp;
-            for (int i = 1; i < N; i++) {
-                int j2 = 0;
-                for (int j = 0; j < N; j++) {
-                    if (j == f) continue;
-                    temp.data[i-1][j2++] = this->data[i][j];
+        if constexpr (Blas::routed<N, T>) {
+            if (!std::is_constant_evaluated()) {
+                Matrix<N, V, T> factors = *this;
+                std::array<int, N> pivots;
+                if (!Blas::getrf(N, factors.data(), pivots.data())) {
+                    throw std::runtime_error("Matrix is singular and cannot be solved.");
                 }
+
+                Vector<N, T> x = b;
+                Blas::getrs(N, factors.data(), pivots.data(), x.data());
+                return x;
             }
-            det += sign * this->data[0][f] * temp.determinant();
-            sign = -sign;
         }
 
-        return det;
+        return lu().solve(b);
     }
 
-    template <int N, int V>
-    Matrix<N, V> Matrix<N, V>::adjoint() const {
+    template <int N, int V, typename T>
+    constexpr Matrix<N, V, T> Matrix<N, V, T>::adjoint() const {
         static_assert(N == V, "Adjoint only defined for square matrices");
 
-        Matrix<N, V> adj;
+        Matrix<N, V, T> adj;
 
         if constexpr (N == 1) {
-            adj.data[0][0] = 1;
+            adj.elements[0] = 1;
             return adj;
-        }
+        } else if constexpr (N <= 4) {
+            closedAdjugate<N>(this->data(), adj.data());
+            return adj;
+        } else {
+            LU<N, T> factors = lu();
 
-        for (int i = 0; i < N; i++) {
-            for (int j = 0; j < N; j++) {
-                Matrix<N-1, N-1> temp;
-                int rowIndex = 0;
-                for (int row = 0; row < N; row++) {
-                    if (row == i) continue;
-                    int colIndex = 0;
-                    for (int col = 0; col < N; col++) {
-                        if (col == j) continue;
-                        temp.data[rowIndex][colIndex++] = this->data[row][col];
+            // adj(A) = det(A) * A^-1 whenever A is invertible
+            if (!factors.singular()) {
+                T det = factors.determinant();
+                Matrix<N, V, T> inv = factors.inverse();
+                for (int i = 0; i < N; i++) {
+                    for (int j = 0; j < N; j++) {
+                        adj.elements[i * N + j] = inv.elements[i * N + j] * det;
                     }
-                    rowIndex++;
                 }
+                return adj;
+            }
+
+            for (int i = 0; i < N; i++) {
+                for (int j = 0; j < N; j++) {
+                    Matrix<N-1, N-1, T> temp;
+                    int rowIndex = 0;
+                    for (int row = 0; row < N; row++) {
+                        if (row == i) continue;
+                        int colIndex = 0;
+                        for (int col = 0; col < N; col++) {
+                            if (col == j) continue;
+                            temp.elements[rowIndex * (N - 1) + colIndex++] = this->elements[row * N + col];
+                        }
+                        rowIndex++;
+                    }
 
-                int sign = ((i + j) % 2 == 0) ? 1 : -1;
-                adj.data[j][i] = sign * temp.determinant();
+                    int sign = ((i + j) % 2 == 0) ? 1 : -1;
+                    adj.elements[j * N + i] = sign * temp.determinant();
+                }
             }
-        }
 
-        return adj;
+            return adj;
+        }
     }
 
-    template <int N, int V>
-    Matrix<N, V> Matrix<N, V>::inverse() const {
+    template <int N, int V, typename T>
+    constexpr Matrix<N, V, T> Matrix<N, V, T>::inverse() const {
         static_assert(N == V, "Inverse only defined for square matrices");
 
-        float det = determinant();
-        if (det == 0) {
-            throw std::runtime_error("Matrix is singular and cannot be inverted.");
+        if constexpr (N >= 2 && N <= 4) {
+            Matrix<N, V, T> inv;
+            T* out = inv.data();
+            T det = closedAdjugate<N>(this->data(), out);
+
+            if (det == 0) {
+                throw std::runtime_error("Matrix is singular and cannot be inverted.");
+            }
+
+            T scale = T(1) / det;
+            for (int i = 0; i < N * N; i++) {
+                out[i] *= scale;
+            }
+
+            return inv;
+        } else {
+            if constexpr (Blas::routed<N, T>) {
+                if (!std::is_constant_evaluated()) {
+                    Matrix<N, V, T> inv = *this;
+                    std::array<int, N> pivots;
+                    if (!Blas::getrf(N, inv.data(), pivots.data())) {
+                        throw std::runtime_error("Matrix is singular and cannot be inverted.");
+                    }
+
+                    Blas::getri(N, inv.data(), pivots.data());
+                    return inv;
+                }
+            }
+
+            return lu().inverse();
         }
+    }
 
-        Matrix<N, V> adj = adjoint();
-        Matrix<N, V> inv;
-        for (int i = 0; i < N; i++) {
-            for (int j = 0; j < N; j++) {
-                inv.data[i][j] = adj.data[i][j] / det;
+    template <int N, int V, typename T>
+    constexpr Matrix<N, V, T> Matrix<N, V, T>::rigidInverse() const {
+        static_assert(N == V && N >= 2, "Rigid inverse only defined for square homogeneous matrices");
+
+        // [R t; 0 1]^-1 = [R^T -R^T t; 0 1]
+        Matrix<N, V, T> inv;
+        for (int i = 0; i < N - 1; i++) {
+            T translation = 0;
+            for (int j = 0; j < N - 1; j++) {
+                inv.elements[i * N + j] = this->elements[j * N + i];
+                translation -= this->elements[j * N + i] * this->elements[j * N + N - 1];
             }
+            inv.elements[i * N + N - 1] = translation;
+            inv.elements[(N - 1) * N + i] = 0;
         }
+        inv.elements[N * N - 1] = 1;
 
         return inv;
     }
 
-    template <int N, int V>
-    Matrix<N, V> Matrix<N, V>::identity() {
+    template <int N, int V, typename T>
+    constexpr Matrix<N, V, T> Matrix<N, V, T>::identity() {
         static_assert(N == V, "Identity only defined for square matrices");
 
         Matrix m = 0;
@@ -107,17 +296,58 @@ namespace Linalg {
         return m;
     }
 
-    template <int N, int V>
-    Vector<N> Matrix<N, V>::operator*(const Vector<V>& rhs) const {
-        Vector<N> result;
+    template <int N, int V, typename T>
+    constexpr Vector<N, T> Matrix<N, V, T>::operator*(const Vector<V, T>& rhs) const {
+        Vector<N, T> result;
+
+        if constexpr (Blas::routed<std::min(N, V), T>) {
+            if (!std::is_constant_evaluated()) {
+                Blas::gemv(N, V, this->data(), rhs.data(), result.data());
+                return result;
+            }
+        }
 
         for (int i = 0; i < N; i++) {
             result[i] = 0;
             for (int j = 0; j < V; j++) {
-                result[i] += this->data[i][j] * rhs[j];
+                result[i] += this->elements[i * V + j] * rhs[j];
+            }
+        }
+
+        return result;
+    }
+
+    template <int N, int V, typename T>
+    template <int K>
+    constexpr Matrix<N, K, T> Matrix<N, V, T>::operator*(const Matrix<V, K, T>& rhs) const {
+        Matrix<N, K, T> result;
+
+        if (std::is_constant_evaluated()) {
+            for (int i = 0; i < N; i++) {
+                for (int j = 0; j < K; j++) {
+                    T sum = 0;
+                    for (int k = 0; k < V; k++) {
+                        sum += this->elements[i * V + k] * rhs.elements[k * K + j];
+                    }
+                    result.elements[i * K + j] = sum;
+                }
             }
+            return result;
         }
 
+        if constexpr (Blas::routed<std::min({N, V, K}), T>) {
+            Blas::gemm(N, V, K, this->data(), rhs.data(), result.data());
+            return result;
+        }
+
+        Kernels::gemm<N, V, K>(this->data(), rhs.data(), result.data());
+
         return result;
     }
+
+    template <int N, int V, typename T>
+    constexpr Matrix<N, V, T>& Matrix<N, V, T>::operator*=(const Matrix<V, V, T>& rhs) {
+        *this = *this * rhs;
+        return *this;
+    }
 }
\ No newline at end of file
@@ -0,0 +1,21 @@
+/**
+ * @file memory.cpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Implementation for the aligned allocators
+ */
+
+#include <linalg/memory.hpp>
+
+namespace Linalg {
+
+    template <typename T, std::size_t Align>
+    T* AlignedAllocator<T, Align>::allocate(std::size_t count) {
+        return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(Align)));
+    }
+
+    template <typename T, std::size_t Align>
+    void AlignedAllocator<T, Align>::deallocate(T* pointer, std::size_t) {
+        ::operator delete(pointer, std::align_val_t(Align));
+    }
+}
\ No newline at end of file
@@ -0,0 +1,151 @@
+/**
+ * @file preconditioner.cpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Implementation for the preconditioners
+ */
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#include <linalg/preconditioner.hpp>
+
+namespace Linalg {
+
+    inline void IdentityPreconditioner::apply(std::span<const float> r, std::span<float> z) const {
+        if (r.size() != z.size()) {
+            throw std::invalid_argument("Shapes do not match.");
+        }
+
+        if (r.data() != z.data()) {
+            std::copy(r.begin(), r.end(), z.begin());
+        }
+    }
+
+    template <SparseLayout L>
+    JacobiPreconditioner::JacobiPreconditioner(const SparseMatrix<L>& a) : inverseDiagonal(a.rows()) {
+        if (a.rows() != a.columns()) {
+            throw std::invalid_argument("Preconditioners need a square matrix.");
+        }
+
+        for (std::size_t i = 0; i < a.rows(); i++) {
+            inverseDiagonal[i] = a.at(i, i);
+        }
+        invert();
+    }
+
+    template <int N>
+    JacobiPreconditioner::JacobiPreconditioner(const Matrix<N, N>& a) : inverseDiagonal(N) {
+        for (int i = 0; i < N; i++) {
+            inverseDiagonal[i] = a[i][i];
+        }
+        invert();
+    }
+
+    inline void JacobiPreconditioner::invert() {
+        for (float& d : inverseDiagonal) {
+            if (d == 0) {
+                throw std::runtime_error("Jacobi preconditioner needs a non zero diagonal.");
+            }
+            d = 1 / d;
+        }
+    }
+
+    inline void JacobiPreconditioner::apply(std::span<const float> r, std::span<float> z) const {
+        if (r.size() != inverseDiagonal.size() || z.size() != inverseDiagonal.size()) {
+            throw std::invalid_argument("Shapes do not match.");
+        }
+
+        for (std::size_t i = 0; i < r.size(); i++) {
+            z[i] = r[i] * inverseDiagonal[i];
+        }
+    }
+
+    inline Ilu0Preconditioner::Ilu0Preconditioner(const CsrMatrix& a) : lu(a), diagonal(a.rows()) {
+        if (a.rows() != a.columns()) {
+            throw std::invalid_argument("Preconditioners need a square matrix.");
+        }
+
+        const std::size_t n = a.rows();
+        const std::size_t* offsets = lu.offsets().data();
+        const std::int32_t* indices = lu.indices().data();
+        float* values = lu.values().data();
+
+        for (std::size_t i = 0; i < n; i++) {
+            const std::int32_t* found = std::lower_bound(indices + offsets[i], indices + offsets[i + 1], std::int32_t(i));
+            if (found == indices + offsets[i + 1] || *found != std::int32_t(i)) {
+                throw std::runtime_error("Zero pivot in the incomplete LU factorization.");
+            }
+            diagonal[i] = found - indices;
+        }
+
+        // IKJ elimination restricted to the pattern, position maps a column
+        // of the row being eliminated to its entry
+        constexpr std::size_t none = std::numeric_limits<std::size_t>::max();
+        std::vector<std::size_t> position(n, none);
+
+        for (std::size_t i = 0; i < n; i++) {
+            for (std::size_t e = offsets[i]; e < offsets[i + 1]; e++) {
+                position[indices[e]] = e;
+            }
+
+            for (std::size_t e = offsets[i]; e < diagonal[i]; e++) {
+                std::size_t k = indices[e];
+                values[e] /= values[diagonal[k]];
+
+                for (std::size_t f = diagonal[k] + 1; f < offsets[k + 1]; f++) {
+                    std::size_t p = position[indices[f]];
+                    if (p != none) {
+                        values[p] -= values[e] * values[f];
+                    }
+                }
+            }
+
+            if (values[diagonal[i]] == 0) {
+                throw std::runtime_error("Zero pivot in the incomplete LU factorization.");
+            }
+
+            for (std::size_t e = offsets[i]; e < offsets[i + 1]; e++) {
+                position[indices[e]] = none;
+            }
+        }
+    }
+
+    inline Ilu0Preconditioner::Ilu0Preconditioner(const CscMatrix& a) : Ilu0Preconditioner(CsrMatrix(a)) {}
+
+    template <int N>
+    Ilu0Preconditioner::Ilu0Preconditioner(const Matrix<N, N>& a) : Ilu0Preconditioner(CsrMatrix(a)) {}
+
+    inline void Ilu0Preconditioner::apply(std::span<const float> r, std::span<float> z) const {
+        const std::size_t n = lu.rows();
+        if (r.size() != n || z.size() != n) {
+            throw std::invalid_argument("Shapes do not match.");
+        }
+
+        const std::size_t* offsets = lu.offsets().data();
+        const std::int32_t* indices = lu.indices().data();
+        const float* values = lu.values().data();
+
+        // L y = r, then U z = y, both in z so that r and z may be the same buffer
+        for (std::size_t i = 0; i < n; i++) {
+            float total = r[i];
+            for (std::size_t e = offsets[i]; e < diagonal[i]; e++) {
+                total -= values[e] * z[indices[e]];
+            }
+            z[i] = total;
+        }
+
+        for (std::size_t i = n; i-- > 0;) {
+            float total = z[i];
+            for (std::size_t e = diagonal[i] + 1; e < offsets[i + 1]; e++) {
+                total -= values[e] * z[indices[e]];
+            }
+            z[i] = total / values[diagonal[i]];
+        }
+    }
+
+    inline const CsrMatrix& Ilu0Preconditioner::factors() const {
+        return lu;
+    }
+}
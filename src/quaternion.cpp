@@ -0,0 +1,201 @@
+/**
+ * @file quaternion.cpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Implementation for the quaternions
+ */
+
+#include <cmath>
+#include <stdexcept>
+
+#include <linalg/quaternion.hpp>
+#include <linalg/simd.hpp>
+#include <linalg/thread_pool.hpp>
+#include <linalg/transform.hpp>
+
+namespace Linalg {
+
+    // below this the arc is close to straight and slerp falls back to nlerp
+    constexpr float SLERP_LINEAR_THRESHOLD = 1e-3f;
+
+    inline Quat Quat::identity() {
+        return {0, 0, 0, 1};
+    }
+
+    inline Quat Quat::axisAngle(const Vec3& axis, float angle) {
+        float s = std::sin(angle / 2);
+        return {axis[0] * s, axis[1] * s, axis[2] * s, std::cos(angle / 2)};
+    }
+
+    // Shepperd's method, the square root is taken of the largest diagonal term
+    inline Quat Quat::fromMatrix(const Mat3& m) {
+        float trace = m[0][0] + m[1][1] + m[2][2];
+
+        if (trace > 0) {
+            float s = std::sqrt(trace + 1) * 2;
+            return {(m[2][1] - m[1][2]) / s, (m[0][2] - m[2][0]) / s, (m[1][0] - m[0][1]) / s, s / 4};
+        }
+        if (m[0][0] > m[1][1] && m[0][0] > m[2][2]) {
+            float s = std::sqrt(1 + m[0][0] - m[1][1] - m[2][2]) * 2;
+            return {s / 4, (m[0][1] + m[1][0]) / s, (m[0][2] + m[2][0]) / s, (m[2][1] - m[1][2]) / s};
+        }
+        if (m[1][1] > m[2][2]) {
+            float s = std::sqrt(1 + m[1][1] - m[0][0] - m[2][2]) * 2;
+            return {(m[0][1] + m[1][0]) / s, s / 4, (m[1][2] + m[2][1]) / s, (m[0][2] - m[2][0]) / s};
+        }
+
+        float s = std::sqrt(1 + m[2][2] - m[0][0] - m[1][1]) * 2;
+        return {(m[0][2] + m[2][0]) / s, (m[1][2] + m[2][1]) / s, s / 4, (m[1][0] - m[0][1]) / s};
+    }
+
+    inline Quat Quat::fromMatrix(const Mat4& m) {
+        return fromMatrix(Mat3{
+            {m[0][0], m[0][1], m[0][2]},
+            {m[1][0], m[1][1], m[1][2]},
+            {m[2][0], m[2][1], m[2][2]}});
+    }
+
+    inline Mat3 Quat::toMat3() const {
+        float x = elements[0], y = elements[1], z = elements[2], w = elements[3];
+        float xx = x * x, yy = y * y, zz = z * z;
+        float xy = x * y, xz = x * z, yz = y * z;
+        float wx = w * x, wy = w * y, wz = w * z;
+
+        return {
+            {1 - 2 * (yy + zz), 2 * (xy - wz), 2 * (xz + wy)},
+            {2 * (xy + wz), 1 - 2 * (xx + zz), 2 * (yz - wx)},
+            {2 * (xz - wy), 2 * (yz + wx), 1 - 2 * (xx + yy)}};
+    }
+
+    inline Mat4 Quat::toMat4() const {
+        Mat3 r = toMat3();
+
+        return {
+            {r[0][0], r[0][1], r[0][2], 0},
+            {r[1][0], r[1][1], r[1][2], 0},
+            {r[2][0], r[2][1], r[2][2], 0},
+            {0, 0, 0, 1}};
+    }
+
+    inline Vec3 Quat::vector() const {
+        return {elements[0], elements[1], elements[2]};
+    }
+
+    inline Quat Quat::operator*(const Quat& rhs) const {
+        float x = elements[0], y = elements[1], z = elements[2], w = elements[3];
+        float rx = rhs.elements[0], ry = rhs.elements[1], rz = rhs.elements[2], rw = rhs.elements[3];
+
+        return {
+            w * rx + x * rw + y * rz - z * ry,
+            w * ry - x * rz + y * rw + z * rx,
+            w * rz + x * ry - y * rx + z * rw,
+            w * rw - x * rx - y * ry - z * rz};
+    }
+
+    inline Quat Quat::conjugate() const {
+        return {-elements[0], -elements[1], -elements[2], elements[3]};
+    }
+
+    inline Quat Quat::inverse() const {
+        float scale = 1 / squaredLength();
+        return {-elements[0] * scale, -elements[1] * scale, -elements[2] * scale, elements[3] * scale};
+    }
+
+    inline Quat Quat::normalize() const {
+        float scale = 1 / length();
+        return {elements[0] * scale, elements[1] * scale, elements[2] * scale, elements[3] * scale};
+    }
+
+    inline Vec3 Quat::rotate(const Vec3& v) const {
+        Vector<3> u = vector();
+        Vector<3> t = u.cross(v);
+        t[0] += t[0];
+        t[1] += t[1];
+        t[2] += t[2];
+        Vector<3> c = u.cross(t);
+
+        float w = elements[3];
+        return {v[0] + w * t[0] + c[0], v[1] + w * t[1] + c[1], v[2] + w * t[2] + c[2]};
+    }
+
+    inline Quat Quat::nlerp(const Quat& to, float t) const {
+        // q and -q are the same rotation, take the one on the near side
+        float sign = dot(to) < 0 ? -1.0f : 1.0f;
+        float a = 1 - t, b = sign * t;
+
+        return Quat{
+            elements[0] * a + to.elements[0] * b,
+            elements[1] * a + to.elements[1] * b,
+            elements[2] * a + to.elements[2] * b,
+            elements[3] * a + to.elements[3] * b}.normalize();
+    }
+
+    inline Quat Quat::slerp(const Quat& to, float t) const {
+        float cosine = dot(to);
+        float sign = cosine < 0 ? -1.0f : 1.0f;
+        cosine *= sign;
+
+        if (1 - cosine < SLERP_LINEAR_THRESHOLD) {
+            return nlerp(to, t);
+        }
+
+        float angle = std::acos(cosine);
+        float inv = 1 / std::sin(angle);
+        float a = std::sin((1 - t) * angle) * inv;
+        float b = sign * std::sin(t * angle) * inv;
+
+        return {
+            elements[0] * a + to.elements[0] * b,
+            elements[1] * a + to.elements[1] * b,
+            elements[2] * a + to.elements[2] * b,
+            elements[3] * a + to.elements[3] * b};
+    }
+
+    // the matrix is built once and the points go through the batched Mat4 path
+    inline void rotate(const Quat& rotation, std::span<const Vec3> in, std::span<Vec3> out) {
+        transformDirections<Vec3>(rotation.toMat4(), in, out);
+    }
+
+    // one rotation per vector, written as a plain loop the compiler vectorizes
+    inline void rotateRange(const Quat* rotations, const Vec3* in, Vec3* out, std::size_t count) {
+        for (std::size_t i = 0; i < count; i++) {
+            out[i] = rotations[i].rotate(in[i]);
+        }
+    }
+
+    inline void rotate(std::span<const Quat> rotations, std::span<const Vec3> in, std::span<Vec3> out) {
+        if (rotations.size() != in.size() || out.size() < in.size()) {
+            throw std::invalid_argument("Spans do not match.");
+        }
+
+        if (in.size() < TRANSFORM_PARALLEL_THRESHOLD) {
+            rotateRange(rotations.data(), in.data(), out.data(), in.size());
+            return;
+        }
+
+        ThreadPool::instance().parallelFor(0, in.size(), TRANSFORM_PARALLEL_THRESHOLD / 4,
+            [&](std::size_t first, std::size_t last) {
+                rotateRange(rotations.data() + first, in.data() + first, out.data() + first, last - first);
+            });
+    }
+
+    inline void compose(std::span<const Quat> a, std::span<const Quat> b, std::span<Quat> out) {
+        if (a.size() != b.size() || out.size() < a.size()) {
+            throw std::invalid_argument("Spans do not match.");
+        }
+
+        for (std::size_t i = 0; i < a.size(); i++) {
+            out[i] = a[i] * b[i];
+        }
+    }
+
+    inline void slerp(std::span<const Quat> from, std::span<const Quat> to, float t, std::span<Quat> out) {
+        if (from.size() != to.size() || out.size() < from.size()) {
+            throw std::invalid_argument("Spans do not match.");
+        }
+
+        for (std::size_t i = 0; i < from.size(); i++) {
+            out[i] = from[i].slerp(to[i], t);
+        }
+    }
+}
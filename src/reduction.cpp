@@ -0,0 +1,242 @@
+/**
+ * @file reduction.cpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Implementation for the tensor reductions
+ */
+
+#include <cmath>
+#include <type_traits>
+
+#include <linalg/reduction.hpp>
+#include <linalg/simd.hpp>
+
+namespace Linalg {
+
+    enum class Reduction { Sum, SumSquares, Max, Min };
+
+    // sums are kept in Accumulator<T>, max and min in T
+    template <Reduction Kind, typename T>
+    using ReductionResult = std::conditional_t<Kind == Reduction::Sum || Kind == Reduction::SumSquares,
+        Accumulator<T>, T>;
+
+    // columns reduced together when the axis is not contiguous, two 1 KiB rows of state
+    constexpr std::size_t REDUCTION_COLUMNS = 256;
+
+    template <typename T>
+    Accumulator<T> pairwiseSum(const T* a, std::size_t n, bool squares) {
+        if (n > Simd::PAIRWISE_BLOCK) {
+            std::size_t half = n / 2;
+            return pairwiseSum(a, half, squares) + pairwiseSum(a + half, n - half, squares);
+        }
+
+        Accumulator<T> result = 0;
+        for (std::size_t i = 0; i < n; i++) {
+            Accumulator<T> value = a[i];
+            result += squares ? value * value : value;
+        }
+        return result;
+    }
+
+    // reduces n contiguous elements
+    template <Reduction Kind, typename T>
+    ReductionResult<Kind, T> reduceLine(const T* a, std::size_t n) {
+        if constexpr (std::is_same_v<T, float>) {
+            switch (Kind) {
+                case Reduction::Sum: return Simd::sum(a, n);
+                case Reduction::SumSquares: return Simd::dot(a, a, n);
+                case Reduction::Max: return Simd::max(a, n);
+                case Reduction::Min: return Simd::min(a, n);
+            }
+        } else {
+            if constexpr (Kind == Reduction::Sum || Kind == Reduction::SumSquares) {
+                return pairwiseSum(a, n, Kind == Reduction::SumSquares);
+            } else {
+                T result = a[0];
+                for (std::size_t i = 1; i < n; i++) {
+                    result = Kind == Reduction::Max ? (a[i] > result ? a[i] : result) : (a[i] < result ? a[i] : result);
+                }
+                return result;
+            }
+        }
+    }
+
+    // out[i] = reduction over k of in[k * inner + i], for i < columns
+    template <Reduction Kind, typename T>
+    void reduceColumns(const T* in, ReductionResult<Kind, T>* out, std::size_t extent, std::size_t inner, std::size_t columns) {
+        typedef ReductionResult<Kind, T> R;
+        constexpr bool sums = Kind == Reduction::Sum || Kind == Reduction::SumSquares;
+
+        // Kahan compensation per column, c holds the low order bits lost by s
+        alignas(64) R s[REDUCTION_COLUMNS];
+        alignas(64) R c[REDUCTION_COLUMNS];
+
+        for (std::size_t i = 0; i < columns; i++) {
+            s[i] = sums ? R(0) : R(in[i]);
+            c[i] = 0;
+        }
+
+        std::size_t packed = 0;
+        if constexpr (std::is_same_v<T, float>) {
+            packed = columns - columns % Simd::WIDTH;
+        }
+
+        for (std::size_t k = sums ? 0 : 1; k < extent; k++) {
+            const T* row = in + k * inner;
+
+            if constexpr (std::is_same_v<T, float>) {
+                for (std::size_t i = 0; i < packed; i += Simd::WIDTH) {
+                    Simd::Packet x = Simd::load(row + i);
+                    Simd::Packet acc = Simd::load(s + i);
+
+                    if constexpr (sums) {
+                        if constexpr (Kind == Reduction::SumSquares) {
+                            x = Simd::mul(x, x);
+                        }
+                        Simd::Packet y = Simd::sub(x, Simd::load(c + i));
+                        Simd::Packet t = Simd::add(acc, y);
+                        Simd::store(c + i, Simd::sub(Simd::sub(t, acc), y));
+                        Simd::store(s + i, t);
+                    } else if constexpr (Kind == Reduction::Max) {
+                        Simd::store(s + i, Simd::max(acc, x));
+                    } else {
+                        Simd::store(s + i, Simd::min(acc, x));
+                    }
+                }
+            }
+
+            for (std::size_t i = packed; i < columns; i++) {
+                R x = row[i];
+
+                if constexpr (sums) {
+                    if constexpr (Kind == Reduction::SumSquares) {
+                        x = x * x;
+                    }
+                    R y = x - c[i];
+                    R t = s[i] + y;
+                    c[i] = (t - s[i]) - y;
+                    s[i] = t;
+                } else if constexpr (Kind == Reduction::Max) {
+                    s[i] = x > s[i] ? x : s[i];
+                } else {
+                    s[i] = x < s[i] ? x : s[i];
+                }
+            }
+        }
+
+        for (std::size_t i = 0; i < columns; i++) {
+            out[i] = s[i];
+        }
+    }
+
+    // the tensor seen as outer x extent x inner, inner varying fastest
+    template <Reduction Kind, int Axis, int... D, typename T>
+    Reduced<NumList<D...>, Axis, ReductionResult<Kind, T>> reduceAxis(const TensorT<NumList<D...>, T>& tensor) {
+        static_assert(Axis >= 0 && Axis < static_cast<int>(sizeof...(D)), "Axis out of range");
+
+        constexpr std::size_t dims[] = {static_cast<std::size_t>(D)...};
+        std::size_t inner = 1, outer = 1;
+        for (std::size_t k = 0; k < sizeof...(D); k++) {
+            if (k < static_cast<std::size_t>(Axis)) inner *= dims[k];
+            if (k > static_cast<std::size_t>(Axis)) outer *= dims[k];
+        }
+        constexpr std::size_t extent = dims[Axis];
+
+        const T* in = tensor.data();
+        Reduced<NumList<D...>, Axis, ReductionResult<Kind, T>> result;
+
+        if constexpr (sizeof...(D) == 1) {
+            result = reduceLine<Kind>(in, extent);
+        } else {
+            ReductionResult<Kind, T>* out = result.data();
+
+            for (std::size_t o = 0; o < outer; o++) {
+                const T* block = in + o * extent * inner;
+
+                if (inner == 1) {
+                    out[o] = reduceLine<Kind>(block, extent);
+                    continue;
+                }
+
+                for (std::size_t i = 0; i < inner; i += REDUCTION_COLUMNS) {
+                    std::size_t columns = inner - i < REDUCTION_COLUMNS ? inner - i : REDUCTION_COLUMNS;
+                    reduceColumns<Kind>(block + i, out + o * inner + i, extent, inner, columns);
+                }
+            }
+        }
+
+        return result;
+    }
+
+    template <int Axis, int... D, typename T>
+    Reduced<NumList<D...>, Axis, Accumulator<T>> sum(const TensorT<NumList<D...>, T>& tensor) {
+        return reduceAxis<Reduction::Sum, Axis>(tensor);
+    }
+
+    template <int Axis, int... D, typename T>
+    Reduced<NumList<D...>, Axis, Accumulator<T>> mean(const TensorT<NumList<D...>, T>& tensor) {
+        constexpr int extent = GetItem<NumList<D...>, Axis>::element;
+
+        Reduced<NumList<D...>, Axis, Accumulator<T>> result = reduceAxis<Reduction::Sum, Axis>(tensor);
+        if constexpr (sizeof...(D) == 1) {
+            return result / extent;
+        } else {
+            return result / static_cast<Accumulator<T>>(extent);
+        }
+    }
+
+    template <int Axis, int... D, typename T>
+    Reduced<NumList<D...>, Axis, T> max(const TensorT<NumList<D...>, T>& tensor) {
+        return reduceAxis<Reduction::Max, Axis>(tensor);
+    }
+
+    template <int Axis, int... D, typename T>
+    Reduced<NumList<D...>, Axis, T> min(const TensorT<NumList<D...>, T>& tensor) {
+        return reduceAxis<Reduction::Min, Axis>(tensor);
+    }
+
+    template <int Axis, int... D, typename T>
+    Reduced<NumList<D...>, Axis, Accumulator<T>> norm(const TensorT<NumList<D...>, T>& tensor) {
+        typedef Accumulator<T> A;
+        Reduced<NumList<D...>, Axis, A> result = reduceAxis<Reduction::SumSquares, Axis>(tensor);
+
+        if constexpr (sizeof...(D) == 1) {
+            return static_cast<A>(std::sqrt(result));
+        } else {
+            for (A& value : result.span()) {
+                value = static_cast<A>(std::sqrt(value));
+            }
+            return result;
+        }
+    }
+
+    template <Reduction Kind, typename T, int... D>
+    ReductionResult<Kind, T> reduceAll(const TensorT<NumList<D...>, T>& tensor) {
+        return reduceLine<Kind>(tensor.data(), tensor.count);
+    }
+
+    template <typename T, int... D>
+    Accumulator<T> sum(const TensorT<NumList<D...>, T>& tensor) {
+        return reduceAll<Reduction::Sum>(tensor);
+    }
+
+    template <typename T, int... D>
+    Accumulator<T> mean(const TensorT<NumList<D...>, T>& tensor) {
+        return reduceAll<Reduction::Sum>(tensor) / static_cast<Accumulator<T>>((static_cast<std::size_t>(D) * ...));
+    }
+
+    template <typename T, int... D>
+    T max(const TensorT<NumList<D...>, T>& tensor) {
+        return reduceAll<Reduction::Max>(tensor);
+    }
+
+    template <typename T, int... D>
+    T min(const TensorT<NumList<D...>, T>& tensor) {
+        return reduceAll<Reduction::Min>(tensor);
+    }
+
+    template <typename T, int... D>
+    Accumulator<T> norm(const TensorT<NumList<D...>, T>& tensor) {
+        return static_cast<Accumulator<T>>(std::sqrt(reduceAll<Reduction::SumSquares>(tensor)));
+    }
+}
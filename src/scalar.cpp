@@ -0,0 +1,122 @@
+/**
+ * @file scalar.cpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Implementation for the 16 bit floating point types
+ */
+
+#include <bit>
+
+#include <linalg/scalar.hpp>
+
+#if defined(__F16C__)
+#include <immintrin.h>
+#endif
+
+namespace Linalg {
+
+    inline Half::Half(float value) {
+#if defined(__F16C__)
+        bits = _cvtss_sh(value, _MM_FROUND_TO_NEAREST_INT);
+#else
+        std::uint32_t x = std::bit_cast<std::uint32_t>(value);
+        std::uint16_t sign = (x >> 16) & 0x8000;
+        std::uint32_t magnitude = x & 0x7fffffff;
+
+        if (magnitude >= 0x7f800000) {
+            // infinity stays infinity, nan stays a quiet nan
+            bits = sign | 0x7c00 | (magnitude > 0x7f800000 ? 0x200 : 0);
+        } else if (magnitude >= 0x477ff000) {
+            // rounds past the largest half
+            bits = sign | 0x7c00;
+        } else if (magnitude < 0x33000000) {
+            // at most half of the smallest subnormal
+            bits = sign;
+        } else if (magnitude < 0x38800000) {
+            int shift = 126 - int(magnitude >> 23);
+            std::uint32_t mantissa = (magnitude & 0x7fffff) | 0x800000;
+            std::uint32_t result = mantissa >> shift;
+            std::uint32_t rest = mantissa & ((1u << shift) - 1);
+            std::uint32_t halfway = 1u << (shift - 1);
+            if (rest > halfway || (rest == halfway && (result & 1))) {
+                result++;
+            }
+            bits = sign | result;
+        } else {
+            std::uint32_t rebiased = magnitude - 0x38000000;
+            std::uint32_t result = rebiased >> 13;
+            std::uint32_t rest = rebiased & 0x1fff;
+            if (rest > 0x1000 || (rest == 0x1000 && (result & 1))) {
+                result++;
+            }
+            bits = sign | result;
+        }
+#endif
+    }
+
+    inline Half::operator float() const {
+#if defined(__F16C__)
+        return _cvtsh_ss(bits);
+#else
+        std::uint32_t sign = std::uint32_t(bits & 0x8000) << 16;
+        std::uint32_t exponent = (bits >> 10) & 0x1f;
+        std::uint32_t mantissa = bits & 0x3ff;
+
+        if (exponent == 0) {
+            if (mantissa == 0) {
+                return std::bit_cast<float>(sign);
+            }
+
+            // subnormal, shift until the implicit bit appears
+            int shift = -1;
+            do {
+                mantissa <<= 1;
+                shift++;
+            } while (!(mantissa & 0x400));
+
+            return std::bit_cast<float>(sign | std::uint32_t(112 - shift) << 23 | (mantissa & 0x3ff) << 13);
+        }
+
+        if (exponent == 31) {
+            return std::bit_cast<float>(sign | 0x7f800000 | mantissa << 13);
+        }
+
+        return std::bit_cast<float>(sign | (exponent + 112) << 23 | mantissa << 13);
+#endif
+    }
+
+    inline Half Half::fromBits(std::uint16_t bits) {
+        Half half;
+        half.bits = bits;
+        return half;
+    }
+
+    inline std::uint16_t Half::toBits() const {
+        return bits;
+    }
+
+    inline BFloat16::BFloat16(float value) {
+        std::uint32_t x = std::bit_cast<std::uint32_t>(value);
+
+        if ((x & 0x7fffffff) > 0x7f800000) {
+            bits = (x >> 16) | 0x40;
+        } else {
+            x += 0x7fff + ((x >> 16) & 1);
+            bits = x >> 16;
+        }
+    }
+
+    inline BFloat16::operator float() const {
+        return std::bit_cast<float>(std::uint32_t(bits) << 16);
+    }
+
+    inline BFloat16 BFloat16::fromBits(std::uint16_t bits) {
+        BFloat16 value;
+        value.bits = bits;
+        return value;
+    }
+
+    inline std::uint16_t BFloat16::toBits() const {
+        return bits;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,381 @@
+/**
+ * @file simd.cpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Implementation for the SIMD packets and kernels
+ */
+
+#include <cmath>
+
+#include <linalg/simd.hpp>
+
+namespace Linalg::Simd {
+
+#if !defined(LINALG_NO_SIMD) && defined(__AVX512F__)
+
+    inline Packet load(const float* p) { return {_mm512_loadu_ps(p)}; }
+    inline void store(float* p, Packet a) { _mm512_storeu_ps(p, a.v); }
+    inline Packet broadcast(float value) { return {_mm512_set1_ps(value)}; }
+    // GCC 12 implements the unmasked forms of gather, sqrt, max, min and the 256 bit
+    // extracts with an undefined source and warns that __Y is used uninitialized at
+    // -O2 -Wall, so the zero-masked forms over every lane are used instead
+    inline Packet gather(const float* base, const std::int32_t* indices) {
+        return {_mm512_mask_i32gather_ps(_mm512_setzero_ps(), 0xFFFF, _mm512_loadu_si512(indices), base, 4)};
+    }
+
+    inline Packet add(Packet a, Packet b) { return {_mm512_add_ps(a.v, b.v)}; }
+    inline Packet sub(Packet a, Packet b) { return {_mm512_sub_ps(a.v, b.v)}; }
+    inline Packet mul(Packet a, Packet b) { return {_mm512_mul_ps(a.v, b.v)}; }
+    inline Packet div(Packet a, Packet b) { return {_mm512_div_ps(a.v, b.v)}; }
+    inline Packet sqrt(Packet a) { return {_mm512_maskz_sqrt_ps(0xFFFF, a.v)}; }
+    inline Packet max(Packet a, Packet b) { return {_mm512_maskz_max_ps(0xFFFF, a.v, b.v)}; }
+    inline Packet min(Packet a, Packet b) { return {_mm512_maskz_min_ps(0xFFFF, a.v, b.v)}; }
+
+    inline Packet fma(Packet a, Packet b, Packet c) { return {_mm512_fmadd_ps(a.v, b.v, c.v)}; }
+    // the two 256 bit halves of a packet, reduced like the AVX packets below
+    template <int Half>
+    inline __m256 half(Packet a) {
+        return _mm256_castpd_ps(_mm512_maskz_extractf64x4_pd(0xF, _mm512_castps_pd(a.v), Half));
+    }
+
+    inline float reduce(Packet a) {
+        __m256 h = _mm256_add_ps(half<0>(a), half<1>(a));
+        __m128 r = _mm_add_ps(_mm256_castps256_ps128(h), _mm256_extractf128_ps(h, 1));
+        r = _mm_add_ps(r, _mm_movehl_ps(r, r));
+        r = _mm_add_ss(r, _mm_shuffle_ps(r, r, 1));
+        return _mm_cvtss_f32(r);
+    }
+
+    inline float reduceMax(Packet a) {
+        __m256 h = _mm256_max_ps(half<0>(a), half<1>(a));
+        __m128 r = _mm_max_ps(_mm256_castps256_ps128(h), _mm256_extractf128_ps(h, 1));
+        r = _mm_max_ps(r, _mm_movehl_ps(r, r));
+        r = _mm_max_ss(r, _mm_shuffle_ps(r, r, 1));
+        return _mm_cvtss_f32(r);
+    }
+
+    inline float reduceMin(Packet a) {
+        __m256 h = _mm256_min_ps(half<0>(a), half<1>(a));
+        __m128 r = _mm_min_ps(_mm256_castps256_ps128(h), _mm256_extractf128_ps(h, 1));
+        r = _mm_min_ps(r, _mm_movehl_ps(r, r));
+        r = _mm_min_ss(r, _mm_shuffle_ps(r, r, 1));
+        return _mm_cvtss_f32(r);
+    }
+
+#elif !defined(LINALG_NO_SIMD) && defined(__AVX__)
+
+    inline Packet load(const float* p) { return {_mm256_loadu_ps(p)}; }
+    inline void store(float* p, Packet a) { _mm256_storeu_ps(p, a.v); }
+    inline Packet broadcast(float value) { return {_mm256_set1_ps(value)}; }
+
+#if defined(__AVX2__)
+    inline Packet gather(const float* base, const std::int32_t* indices) {
+        return {_mm256_i32gather_ps(base, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices)), 4)};
+    }
+#else
+    inline Packet gather(const float* base, const std::int32_t* indices) {
+        return {_mm256_setr_ps(base[indices[0]], base[indices[1]], base[indices[2]], base[indices[3]],
+            base[indices[4]], base[indices[5]], base[indices[6]], base[indices[7]])};
+    }
+#endif
+
+    inline Packet add(Packet a, Packet b) { return {_mm256_add_ps(a.v, b.v)}; }
+    inline Packet sub(Packet a, Packet b) { return {_mm256_sub_ps(a.v, b.v)}; }
+    inline Packet mul(Packet a, Packet b) { return {_mm256_mul_ps(a.v, b.v)}; }
+    inline Packet div(Packet a, Packet b) { return {_mm256_div_ps(a.v, b.v)}; }
+    inline Packet sqrt(Packet a) { return {_mm256_sqrt_ps(a.v)}; }
+    inline Packet max(Packet a, Packet b) { return {_mm256_max_ps(a.v, b.v)}; }
+    inline Packet min(Packet a, Packet b) { return {_mm256_min_ps(a.v, b.v)}; }
+
+#if defined(__FMA__)
+    inline Packet fma(Packet a, Packet b, Packet c) { return {_mm256_fmadd_ps(a.v, b.v, c.v)}; }
+#else
+    inline Packet fma(Packet a, Packet b, Packet c) { return add(mul(a, b), c); }
+#endif
+
+    inline float reduce(Packet a) {
+        __m128 r = _mm_add_ps(_mm256_castps256_ps128(a.v), _mm256_extractf128_ps(a.v, 1));
+        r = _mm_add_ps(r, _mm_movehl_ps(r, r));
+        r = _mm_add_ss(r, _mm_shuffle_ps(r, r, 1));
+        return _mm_cvtss_f32(r);
+    }
+
+    inline float reduceMax(Packet a) {
+        __m128 r = _mm_max_ps(_mm256_castps256_ps128(a.v), _mm256_extractf128_ps(a.v, 1));
+        r = _mm_max_ps(r, _mm_movehl_ps(r, r));
+        r = _mm_max_ss(r, _mm_shuffle_ps(r, r, 1));
+        return _mm_cvtss_f32(r);
+    }
+
+    inline float reduceMin(Packet a) {
+        __m128 r = _mm_min_ps(_mm256_castps256_ps128(a.v), _mm256_extractf128_ps(a.v, 1));
+        r = _mm_min_ps(r, _mm_movehl_ps(r, r));
+        r = _mm_min_ss(r, _mm_shuffle_ps(r, r, 1));
+        return _mm_cvtss_f32(r);
+    }
+
+#elif !defined(LINALG_NO_SIMD) && defined(__SSE2__)
+
+    inline Packet load(const float* p) { return {_mm_loadu_ps(p)}; }
+    inline void store(float* p, Packet a) { _mm_storeu_ps(p, a.v); }
+    inline Packet broadcast(float value) { return {_mm_set1_ps(value)}; }
+    inline Packet gather(const float* base, const std::int32_t* indices) {
+        return {_mm_setr_ps(base[indices[0]], base[indices[1]], base[indices[2]], base[indices[3]])};
+    }
+
+    inline Packet add(Packet a, Packet b) { return {_mm_add_ps(a.v, b.v)}; }
+    inline Packet sub(Packet a, Packet b) { return {_mm_sub_ps(a.v, b.v)}; }
+    inline Packet mul(Packet a, Packet b) { return {_mm_mul_ps(a.v, b.v)}; }
+    inline Packet div(Packet a, Packet b) { return {_mm_div_ps(a.v, b.v)}; }
+    inline Packet sqrt(Packet a) { return {_mm_sqrt_ps(a.v)}; }
+    inline Packet max(Packet a, Packet b) { return {_mm_max_ps(a.v, b.v)}; }
+    inline Packet min(Packet a, Packet b) { return {_mm_min_ps(a.v, b.v)}; }
+
+    inline Packet fma(Packet a, Packet b, Packet c) { return add(mul(a, b), c); }
+
+    inline float reduce(Packet a) {
+        __m128 r = _mm_add_ps(a.v, _mm_movehl_ps(a.v, a.v));
+        r = _mm_add_ss(r, _mm_shuffle_ps(r, r, 1));
+        return _mm_cvtss_f32(r);
+    }
+
+    inline float reduceMax(Packet a) {
+        __m128 r = _mm_max_ps(a.v, _mm_movehl_ps(a.v, a.v));
+        r = _mm_max_ss(r, _mm_shuffle_ps(r, r, 1));
+        return _mm_cvtss_f32(r);
+    }
+
+    inline float reduceMin(Packet a) {
+        __m128 r = _mm_min_ps(a.v, _mm_movehl_ps(a.v, a.v));
+        r = _mm_min_ss(r, _mm_shuffle_ps(r, r, 1));
+        return _mm_cvtss_f32(r);
+    }
+
+#else
+
+    inline Packet load(const float* p) { return {*p}; }
+    inline void store(float* p, Packet a) { *p = a.v; }
+    inline Packet broadcast(float value) { return {value}; }
+    inline Packet gather(const float* base, const std::int32_t* indices) { return {base[*indices]}; }
+
+    inline Packet add(Packet a, Packet b) { return {a.v + b.v}; }
+    inline Packet sub(Packet a, Packet b) { return {a.v - b.v}; }
+    inline Packet mul(Packet a, Packet b) { return {a.v * b.v}; }
+    inline Packet div(Packet a, Packet b) { return {a.v / b.v}; }
+    inline Packet sqrt(Packet a) { return {std::sqrt(a.v)}; }
+    inline Packet max(Packet a, Packet b) { return {a.v > b.v ? a.v : b.v}; }
+    inline Packet min(Packet a, Packet b) { return {a.v < b.v ? a.v : b.v}; }
+
+    inline Packet fma(Packet a, Packet b, Packet c) { return {a.v * b.v + c.v}; }
+    inline float reduce(Packet a) { return a.v; }
+    inline float reduceMax(Packet a) { return a.v; }
+    inline float reduceMin(Packet a) { return a.v; }
+
+#endif
+
+    // splits a range longer than PAIRWISE_BLOCK roughly in half, on a whole number of unrolled steps
+    inline std::size_t pairwiseHalf(std::size_t n) {
+        return n / 2 / (4 * WIDTH) * (4 * WIDTH);
+    }
+
+    // four independent accumulators hide the add latency,
+    // then one packet at a time, then a scalar tail
+    inline float dot(const float* a, const float* b, std::size_t n) {
+        if (n > PAIRWISE_BLOCK) {
+            std::size_t half = pairwiseHalf(n);
+            return dot(a, b, half) + dot(a + half, b + half, n - half);
+        }
+
+        std::size_t i = 0;
+
+        if (n < WIDTH) {
+            float result = 0;
+            for (; i < n; i++) {
+                result += a[i] * b[i];
+            }
+            return result;
+        }
+
+        Packet acc0 = broadcast(0), acc1 = broadcast(0), acc2 = broadcast(0), acc3 = broadcast(0);
+
+        for (; i + 4 * WIDTH <= n; i += 4 * WIDTH) {
+            acc0 = fma(load(a + i), load(b + i), acc0);
+            acc1 = fma(load(a + i + WIDTH), load(b + i + WIDTH), acc1);
+            acc2 = fma(load(a + i + 2 * WIDTH), load(b + i + 2 * WIDTH), acc2);
+            acc3 = fma(load(a + i + 3 * WIDTH), load(b + i + 3 * WIDTH), acc3);
+        }
+
+        for (; i + WIDTH <= n; i += WIDTH) {
+            acc0 = fma(load(a + i), load(b + i), acc0);
+        }
+
+        float result = reduce(add(add(acc0, acc1), add(acc2, acc3)));
+
+        for (; i < n; i++) {
+            result += a[i] * b[i];
+        }
+
+        return result;
+    }
+
+    inline void axpy(float a, const float* x, float* y, std::size_t n) {
+        std::size_t i = 0;
+        std::size_t packed = n - n % WIDTH;
+        Packet scale = broadcast(a);
+
+        for (; i < packed; i += WIDTH) {
+            store(y + i, fma(scale, load(x + i), load(y + i)));
+        }
+
+        for (; i < n; i++) {
+            y[i] += a * x[i];
+        }
+    }
+
+    inline float sum(const float* a, std::size_t n) {
+        if (n > PAIRWISE_BLOCK) {
+            std::size_t half = pairwiseHalf(n);
+            return sum(a, half) + sum(a + half, n - half);
+        }
+
+        std::size_t i = 0;
+
+        if (n < WIDTH) {
+            float result = 0;
+            for (; i < n; i++) {
+                result += a[i];
+            }
+            return result;
+        }
+
+        Packet acc0 = broadcast(0), acc1 = broadcast(0), acc2 = broadcast(0), acc3 = broadcast(0);
+
+        for (; i + 4 * WIDTH <= n; i += 4 * WIDTH) {
+            acc0 = add(load(a + i), acc0);
+            acc1 = add(load(a + i + WIDTH), acc1);
+            acc2 = add(load(a + i + 2 * WIDTH), acc2);
+            acc3 = add(load(a + i + 3 * WIDTH), acc3);
+        }
+
+        for (; i + WIDTH <= n; i += WIDTH) {
+            acc0 = add(load(a + i), acc0);
+        }
+
+        float result = reduce(add(add(acc0, acc1), add(acc2, acc3)));
+
+        for (; i < n; i++) {
+            result += a[i];
+        }
+
+        return result;
+    }
+
+    template <typename Op, typename Reduce, typename Scalar>
+    inline float extremum(const float* a, std::size_t n, Op op, Reduce reduceOp, Scalar scalar) {
+        float result = a[0];
+        std::size_t i = 0;
+
+        if (n >= WIDTH) {
+            Packet acc0 = load(a), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+
+            for (std::size_t blocks = n - n % (4 * WIDTH); i < blocks; i += 4 * WIDTH) {
+                acc0 = op(load(a + i), acc0);
+                acc1 = op(load(a + i + WIDTH), acc1);
+                acc2 = op(load(a + i + 2 * WIDTH), acc2);
+                acc3 = op(load(a + i + 3 * WIDTH), acc3);
+            }
+
+            result = reduceOp(op(op(acc0, acc1), op(acc2, acc3)));
+        }
+
+        for (; i < n; i++) {
+            result = scalar(result, a[i]);
+        }
+
+        return result;
+    }
+
+    inline float max(const float* a, std::size_t n) {
+        return extremum(a, n, [](Packet x, Packet y) { return max(x, y); }, reduceMax,
+            [](float x, float y) { return x > y ? x : y; });
+    }
+
+    inline float min(const float* a, std::size_t n) {
+        return extremum(a, n, [](Packet x, Packet y) { return min(x, y); }, reduceMin,
+            [](float x, float y) { return x < y ? x : y; });
+    }
+
+#if !defined(LINALG_NO_SIMD) && defined(__SSE2__)
+
+    // rows of 2x2 blocks packed as (a00, a01, a10, a11)
+    inline __m128 mul2(__m128 a, __m128 b) {
+        return _mm_add_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 3, 0))),
+            _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+    }
+
+    // adj(a) * b
+    inline __m128 adjMul2(__m128 a, __m128 b) {
+        return _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 3, 3)), b),
+            _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2))));
+    }
+
+    // a * adj(b)
+    inline __m128 mulAdj2(__m128 a, __m128 b) {
+        return _mm_sub_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 3, 0, 3))),
+            _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+    }
+
+    // M = [A B; C D] in 2x2 blocks, the blocks of adj(M) are built from adj(A) B and adj(D) C
+    // so every 2x2 sub-determinant is computed once
+    inline float adjugate4(const float* m, float* out) {
+        __m128 r0 = _mm_loadu_ps(m);
+        __m128 r1 = _mm_loadu_ps(m + 4);
+        __m128 r2 = _mm_loadu_ps(m + 8);
+        __m128 r3 = _mm_loadu_ps(m + 12);
+
+        __m128 a = _mm_movelh_ps(r0, r1);
+        __m128 b = _mm_movehl_ps(r1, r0);
+        __m128 c = _mm_movelh_ps(r2, r3);
+        __m128 d = _mm_movehl_ps(r3, r2);
+
+        // (|A|, |B|, |C|, |D|)
+        __m128 dets = _mm_sub_ps(
+            _mm_mul_ps(_mm_shuffle_ps(r0, r2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(r1, r3, _MM_SHUFFLE(3, 1, 3, 1))),
+            _mm_mul_ps(_mm_shuffle_ps(r0, r2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(r1, r3, _MM_SHUFFLE(2, 0, 2, 0))));
+        __m128 detA = _mm_shuffle_ps(dets, dets, _MM_SHUFFLE(0, 0, 0, 0));
+        __m128 detB = _mm_shuffle_ps(dets, dets, _MM_SHUFFLE(1, 1, 1, 1));
+        __m128 detC = _mm_shuffle_ps(dets, dets, _MM_SHUFFLE(2, 2, 2, 2));
+        __m128 detD = _mm_shuffle_ps(dets, dets, _MM_SHUFFLE(3, 3, 3, 3));
+
+        __m128 dc = adjMul2(d, c);
+        __m128 ab = adjMul2(a, b);
+
+        // adjugates of the blocks of adj(M), in the order they are stored
+        __m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), mul2(b, dc));
+        __m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), mul2(c, ab));
+        __m128 y = _mm_sub_ps(_mm_mul_ps(detB, c), mulAdj2(d, ab));
+        __m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), mulAdj2(a, dc));
+
+        // |M| = |A| |D| + |B| |C| - tr(adj(A) B adj(D) C)
+        __m128 trace = _mm_mul_ps(ab, _mm_shuffle_ps(dc, dc, _MM_SHUFFLE(3, 1, 2, 0)));
+        trace = _mm_add_ps(trace, _mm_movehl_ps(trace, trace));
+        trace = _mm_add_ss(trace, _mm_shuffle_ps(trace, trace, 1));
+        __m128 det = _mm_sub_ss(_mm_add_ss(_mm_mul_ss(detA, detD), _mm_mul_ss(detB, detC)), trace);
+
+        __m128 sign = _mm_setr_ps(1, -1, -1, 1);
+        x = _mm_mul_ps(x, sign);
+        y = _mm_mul_ps(y, sign);
+        z = _mm_mul_ps(z, sign);
+        w = _mm_mul_ps(w, sign);
+
+        // taking the adjugate of each block and unpacking them to rows in one shuffle
+        _mm_storeu_ps(out, _mm_shuffle_ps(x, y, _MM_SHUFFLE(1, 3, 1, 3)));
+        _mm_storeu_ps(out + 4, _mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 2, 0, 2)));
+        _mm_storeu_ps(out + 8, _mm_shuffle_ps(z, w, _MM_SHUFFLE(1, 3, 1, 3)));
+        _mm_storeu_ps(out + 12, _mm_shuffle_ps(z, w, _MM_SHUFFLE(0, 2, 0, 2)));
+
+        return _mm_cvtss_f32(det);
+    }
+
+#endif
+}
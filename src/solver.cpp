@@ -0,0 +1,354 @@
+/**
+ * @file solver.cpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Implementation for the iterative solvers
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <linalg/simd.hpp>
+#include <linalg/solver.hpp>
+
+namespace Linalg {
+
+    // y = A x for everything the solvers accept as A
+    template <typename Policy, SparseLayout L>
+    void applyOperator(const Policy& policy, const SparseMatrix<L>& a, std::span<const float> x, std::span<float> y) {
+        multiply(policy, a, x, y);
+    }
+
+    template <typename Policy, int N>
+    void applyOperator(const Policy&, const Matrix<N, N>& a, std::span<const float> x, std::span<float> y) {
+        if (x.size() != N || y.size() != N) {
+            throw std::invalid_argument("Shapes do not match.");
+        }
+
+        // a span says nothing about alignment, so x goes through a Vector
+        Vector<N> in;
+        std::copy(x.begin(), x.end(), in.data());
+        Vector<N> out = a * in;
+        std::copy(out.data(), out.data() + N, y.begin());
+    }
+
+    template <typename Policy, typename F,
+        std::enable_if_t<std::is_invocable_v<const F&, std::span<const float>, std::span<float>>, int> = 0>
+    void applyOperator(const Policy&, const F& f, std::span<const float> x, std::span<float> y) {
+        f(x, y);
+    }
+
+    inline float norm(std::span<const float> v) {
+        return std::sqrt(Simd::dot(v.data(), v.data(), v.size()));
+    }
+
+    inline std::size_t checkSystem(std::span<const float> b, std::span<float> x) {
+        if (b.size() != x.size()) {
+            throw std::invalid_argument("Shapes do not match.");
+        }
+        return b.size();
+    }
+
+    inline void notify(const SolverOptions& options, const SolverReport& report) {
+        if (options.monitor) {
+            options.monitor(report.iterations, report.residual);
+        }
+    }
+
+    // r = b - A x, returns ||r|| / ||b||
+    template <typename Policy, typename Operator>
+    float residual(const Policy& policy, const Operator& a, std::span<const float> b, std::span<const float> x,
+        std::span<float> r, float bNorm) {
+        applyOperator(policy, a, x, r);
+        for (std::size_t i = 0; i < r.size(); i++) {
+            r[i] = b[i] - r[i];
+        }
+        return norm(r) / bNorm;
+    }
+
+    inline ConjugateGradient::ConjugateGradient(SolverOptions options) : options(std::move(options)) {}
+
+    template <typename Policy, typename Operator, typename Preconditioner>
+    SolverReport ConjugateGradient::solve(const Policy& policy, const Operator& a, std::span<const float> b,
+        std::span<float> x, const Preconditioner& m) {
+        const std::size_t n = checkSystem(b, x);
+        for (AlignedVector<float>* buffer : {&r, &z, &p, &q}) {
+            buffer->resize(n);
+        }
+
+        SolverReport report;
+        float bNorm = norm(b);
+        if (bNorm == 0) {
+            std::fill(x.begin(), x.end(), 0.0f);
+            report.converged = true;
+            return report;
+        }
+
+        report.residual = residual(policy, a, b, x, r, bNorm);
+        report.converged = report.residual <= options.tolerance;
+
+        m.apply(r, z);
+        std::copy(z.begin(), z.end(), p.begin());
+        float rz = Simd::dot(r.data(), z.data(), n);
+
+        while (!report.converged && report.iterations < options.maxIterations) {
+            applyOperator(policy, a, p, q);
+
+            // not positive definite, or p is already zero
+            float pq = Simd::dot(p.data(), q.data(), n);
+            if (!(pq > 0)) {
+                break;
+            }
+
+            float alpha = rz / pq;
+            Simd::axpy(alpha, p.data(), x.data(), n);
+            Simd::axpy(-alpha, q.data(), r.data(), n);
+
+            report.iterations++;
+            report.residual = norm(r) / bNorm;
+            report.converged = report.residual <= options.tolerance;
+            notify(options, report);
+            if (report.converged) {
+                break;
+            }
+
+            m.apply(r, z);
+            float rzNext = Simd::dot(r.data(), z.data(), n);
+            float beta = rzNext / rz;
+            rz = rzNext;
+
+            for (std::size_t i = 0; i < n; i++) {
+                p[i] = z[i] + beta * p[i];
+            }
+        }
+
+        return report;
+    }
+
+    template <typename Operator, typename Preconditioner>
+    SolverReport ConjugateGradient::solve(const Operator& a, std::span<const float> b, std::span<float> x,
+        const Preconditioner& m) {
+        return solve(seq, a, b, x, m);
+    }
+
+    inline BiCgStab::BiCgStab(SolverOptions options) : options(std::move(options)) {}
+
+    template <typename Policy, typename Operator, typename Preconditioner>
+    SolverReport BiCgStab::solve(const Policy& policy, const Operator& a, std::span<const float> b,
+        std::span<float> x, const Preconditioner& m) {
+        const std::size_t n = checkSystem(b, x);
+        for (AlignedVector<float>* buffer : {&r, &rHat, &p, &v, &s, &t, &y, &z}) {
+            buffer->resize(n);
+        }
+
+        SolverReport report;
+        float bNorm = norm(b);
+        if (bNorm == 0) {
+            std::fill(x.begin(), x.end(), 0.0f);
+            report.converged = true;
+            return report;
+        }
+
+        report.residual = residual(policy, a, b, x, r, bNorm);
+        report.converged = report.residual <= options.tolerance;
+
+        std::copy(r.begin(), r.end(), rHat.begin());
+        std::fill(p.begin(), p.end(), 0.0f);
+        std::fill(v.begin(), v.end(), 0.0f);
+        float rho = 1;
+        float alpha = 1;
+        float omega = 1;
+
+        while (!report.converged && report.iterations < options.maxIterations) {
+            // a zero rho or rHat . v is a breakdown of the method, not convergence
+            float rhoNext = Simd::dot(rHat.data(), r.data(), n);
+            if (rhoNext == 0) {
+                break;
+            }
+
+            float beta = (rhoNext / rho) * (alpha / omega);
+            rho = rhoNext;
+            for (std::size_t i = 0; i < n; i++) {
+                p[i] = r[i] + beta * (p[i] - omega * v[i]);
+            }
+
+            m.apply(p, y);
+            applyOperator(policy, a, y, v);
+
+            float rv = Simd::dot(rHat.data(), v.data(), n);
+            if (rv == 0) {
+                break;
+            }
+            alpha = rho / rv;
+
+            for (std::size_t i = 0; i < n; i++) {
+                s[i] = r[i] - alpha * v[i];
+            }
+
+            report.iterations++;
+            float sResidual = norm(s) / bNorm;
+            if (sResidual <= options.tolerance) {
+                Simd::axpy(alpha, y.data(), x.data(), n);
+                report.residual = sResidual;
+                report.converged = true;
+                notify(options, report);
+                break;
+            }
+
+            m.apply(s, z);
+            applyOperator(policy, a, z, t);
+
+            float tt = Simd::dot(t.data(), t.data(), n);
+            omega = tt > 0 ? Simd::dot(t.data(), s.data(), n) / tt : 0;
+
+            Simd::axpy(alpha, y.data(), x.data(), n);
+            Simd::axpy(omega, z.data(), x.data(), n);
+            for (std::size_t i = 0; i < n; i++) {
+                r[i] = s[i] - omega * t[i];
+            }
+
+            report.residual = norm(r) / bNorm;
+            report.converged = report.residual <= options.tolerance;
+            notify(options, report);
+
+            if (omega == 0) {
+                break;
+            }
+        }
+
+        return report;
+    }
+
+    template <typename Operator, typename Preconditioner>
+    SolverReport BiCgStab::solve(const Operator& a, std::span<const float> b, std::span<float> x,
+        const Preconditioner& m) {
+        return solve(seq, a, b, x, m);
+    }
+
+    inline Gmres::Gmres(SolverOptions options) : options(std::move(options)) {}
+
+    template <typename Policy, typename Operator, typename Preconditioner>
+    SolverReport Gmres::solve(const Policy& policy, const Operator& a, std::span<const float> b,
+        std::span<float> x, const Preconditioner& m) {
+        const std::size_t n = checkSystem(b, x);
+        const std::size_t k = std::max<std::size_t>(1, std::min(options.restart, options.maxIterations));
+
+        basis.resize((k + 1) * n);
+        hessenberg.resize((k + 1) * k);
+        cosines.resize(k);
+        sines.resize(k);
+        g.resize(k + 1);
+        w.resize(n);
+        z.resize(n);
+
+        auto h = [this, k](std::size_t i, std::size_t j) -> float& { return hessenberg[i * k + j]; };
+        auto krylov = [this, n](std::size_t i) { return std::span<float>(basis.data() + i * n, n); };
+
+        SolverReport report;
+        float bNorm = norm(b);
+        if (bNorm == 0) {
+            std::fill(x.begin(), x.end(), 0.0f);
+            report.converged = true;
+            return report;
+        }
+
+        while (true) {
+            // every restart starts from the true residual
+            std::span<float> v0 = krylov(0);
+            report.residual = residual(policy, a, b, x, v0, bNorm);
+            report.converged = report.residual <= options.tolerance;
+            if (report.converged || report.iterations >= options.maxIterations) {
+                break;
+            }
+
+            float beta = report.residual * bNorm;
+            for (float& e : v0) {
+                e /= beta;
+            }
+            std::fill(g.begin(), g.end(), 0.0f);
+            g[0] = beta;
+
+            std::size_t j = 0;
+            bool exact = false;
+            while (j < k && report.iterations < options.maxIterations) {
+                m.apply(krylov(j), z);
+                applyOperator(policy, a, z, w);
+
+                for (std::size_t i = 0; i <= j; i++) {
+                    float hij = Simd::dot(w.data(), krylov(i).data(), n);
+                    h(i, j) = hij;
+                    Simd::axpy(-hij, krylov(i).data(), w.data(), n);
+                }
+
+                float next = norm(w);
+                h(j + 1, j) = next;
+                exact = next == 0;
+                if (!exact) {
+                    std::span<float> vNext = krylov(j + 1);
+                    for (std::size_t i = 0; i < n; i++) {
+                        vNext[i] = w[i] / next;
+                    }
+                }
+
+                for (std::size_t i = 0; i < j; i++) {
+                    float upper = cosines[i] * h(i, j) + sines[i] * h(i + 1, j);
+                    h(i + 1, j) = -sines[i] * h(i, j) + cosines[i] * h(i + 1, j);
+                    h(i, j) = upper;
+                }
+
+                // the rotation that zeroes h(j + 1, j) also rotates the residual g
+                float length = std::hypot(h(j, j), h(j + 1, j));
+                cosines[j] = length > 0 ? h(j, j) / length : 1;
+                sines[j] = length > 0 ? h(j + 1, j) / length : 0;
+                h(j, j) = length;
+                h(j + 1, j) = 0;
+                g[j + 1] = -sines[j] * g[j];
+                g[j] = cosines[j] * g[j];
+
+                j++;
+                report.iterations++;
+                report.residual = std::abs(g[j]) / bNorm;
+                notify(options, report);
+
+                if (report.residual <= options.tolerance || exact) {
+                    break;
+                }
+            }
+
+            // y = H^-1 g on the leading j x j triangle, written over g
+            for (std::size_t i = j; i-- > 0;) {
+                float total = g[i];
+                for (std::size_t c = i + 1; c < j; c++) {
+                    total -= h(i, c) * g[c];
+                }
+                g[i] = h(i, i) != 0 ? total / h(i, i) : 0;
+            }
+
+            // x += M^-1 (V y)
+            std::fill(w.begin(), w.end(), 0.0f);
+            for (std::size_t i = 0; i < j; i++) {
+                Simd::axpy(g[i], krylov(i).data(), w.data(), n);
+            }
+            m.apply(w, z);
+            Simd::axpy(1.0f, z.data(), x.data(), n);
+
+            // like the other solvers, trust the residual the method tracks. In float the
+            // recomputed one can sit above the tolerance on badly conditioned systems
+            if (report.residual <= options.tolerance) {
+                report.converged = true;
+                break;
+            }
+        }
+
+        return report;
+    }
+
+    template <typename Operator, typename Preconditioner>
+    SolverReport Gmres::solve(const Operator& a, std::span<const float> b, std::span<float> x,
+        const Preconditioner& m) {
+        return solve(seq, a, b, x, m);
+    }
+}
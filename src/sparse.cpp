@@ -0,0 +1,432 @@
+/**
+ * @file sparse.cpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Implementation for the sparse matrices
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include <linalg/simd.hpp>
+#include <linalg/sparse.hpp>
+
+namespace Linalg {
+
+    inline SparseTriplets::SparseTriplets(std::size_t rows, std::size_t columns)
+        : rowCount(rows), columnCount(columns) {}
+
+    inline void SparseTriplets::reserve(std::size_t count) {
+        rowIndex.reserve(count);
+        columnIndex.reserve(count);
+        entries.reserve(count);
+    }
+
+    inline void SparseTriplets::clear() {
+        rowIndex.clear();
+        columnIndex.clear();
+        entries.clear();
+    }
+
+    inline void SparseTriplets::add(std::size_t row, std::size_t column, float value) {
+        if (row >= rowCount || column >= columnCount) {
+            throw std::out_of_range("Sparse index out of range.");
+        }
+
+        rowIndex.push_back(row);
+        columnIndex.push_back(column);
+        entries.push_back(value);
+    }
+
+    inline std::size_t SparseTriplets::rows() const {
+        return rowCount;
+    }
+
+    inline std::size_t SparseTriplets::columns() const {
+        return columnCount;
+    }
+
+    inline std::size_t SparseTriplets::size() const {
+        return entries.size();
+    }
+
+    inline std::span<const std::size_t> SparseTriplets::rowIndices() const {
+        return rowIndex;
+    }
+
+    inline std::span<const std::size_t> SparseTriplets::columnIndices() const {
+        return columnIndex;
+    }
+
+    inline std::span<const float> SparseTriplets::values() const {
+        return entries;
+    }
+
+    // positions of the entries stably sorted by keys[position]
+    inline std::vector<std::size_t> sortByKey(std::span<const std::size_t> keys, std::size_t keyCount) {
+        std::vector<std::size_t> next(keyCount + 1, 0);
+        for (std::size_t key : keys) {
+            next[key + 1]++;
+        }
+        for (std::size_t k = 0; k < keyCount; k++) {
+            next[k + 1] += next[k];
+        }
+
+        std::vector<std::size_t> sorted(keys.size());
+        for (std::size_t p = 0; p < keys.size(); p++) {
+            sorted[next[keys[p]]++] = p;
+        }
+        return sorted;
+    }
+
+    template <SparseLayout L>
+    SparseMatrix<L>::SparseMatrix(std::size_t rows, std::size_t columns)
+        : rowCount(rows), columnCount(columns), starts(outerCount() + 1, 0) {
+        // indices are stored as 32 bits so that a packet of them can be gathered
+        constexpr std::size_t largest = std::numeric_limits<std::int32_t>::max();
+        if (rows > largest || columns > largest) {
+            throw std::invalid_argument("Sparse matrices are limited to 2^31 - 1 rows and columns.");
+        }
+    }
+
+    template <SparseLayout L>
+    SparseMatrix<L>::SparseMatrix(const SparseTriplets& triplets) : SparseMatrix(triplets.rows(), triplets.columns()) {
+        std::span<const std::size_t> outerIndex = L == SparseLayout::Rows ? triplets.rowIndices() : triplets.columnIndices();
+        std::span<const std::size_t> innerIndex = L == SparseLayout::Rows ? triplets.columnIndices() : triplets.rowIndices();
+        std::span<const float> values = triplets.values();
+
+        // one counting pass by outer index, then each outer entry is sorted by inner
+        // index on its own, by insertion for the short rows of assembled matrices
+        std::vector<std::size_t> order = sortByKey(outerIndex, outerCount());
+        auto byInner = [&](std::size_t a, std::size_t b) { return innerIndex[a] < innerIndex[b]; };
+
+        for (std::size_t first = 0, last = 0; first < order.size(); first = last) {
+            for (last = first + 1; last < order.size() && outerIndex[order[last]] == outerIndex[order[first]]; last++) {}
+
+            if (last - first > 32) {
+                std::stable_sort(order.begin() + first, order.begin() + last, byInner);
+                continue;
+            }
+
+            for (std::size_t e = first + 1; e < last; e++) {
+                std::size_t p = order[e];
+                std::size_t q = e;
+                for (; q > first && byInner(p, order[q - 1]); q--) {
+                    order[q] = order[q - 1];
+                }
+                order[q] = p;
+            }
+        }
+
+        inner.reserve(order.size());
+        entries.reserve(order.size());
+
+        std::size_t previous = std::numeric_limits<std::size_t>::max();
+        for (std::size_t p : order) {
+            std::size_t o = outerIndex[p];
+            std::int32_t i = static_cast<std::int32_t>(innerIndex[p]);
+
+            if (o == previous && inner.back() == i) {
+                entries.back() += values[p];
+                continue;
+            }
+
+            inner.push_back(i);
+            entries.push_back(values[p]);
+            starts[o + 1]++;
+            previous = o;
+        }
+
+        for (std::size_t k = 0; k < outerCount(); k++) {
+            starts[k + 1] += starts[k];
+        }
+    }
+
+    template <SparseLayout L>
+    SparseMatrix<L>::SparseMatrix(std::size_t rows, std::size_t columns, std::vector<std::size_t> offsets,
+        AlignedVector<std::int32_t> indices, AlignedVector<float> values) : SparseMatrix(rows, columns) {
+        bool valid = offsets.size() == outerCount() + 1 && offsets.front() == 0 &&
+            offsets.back() == indices.size() && indices.size() == values.size();
+
+        for (std::size_t k = 0; valid && k < outerCount(); k++) {
+            valid = offsets[k] <= offsets[k + 1];
+            for (std::size_t e = offsets[k]; valid && e < offsets[k + 1]; e++) {
+                valid = indices[e] >= 0 && std::size_t(indices[e]) < innerCount() &&
+                    (e == offsets[k] || indices[e - 1] < indices[e]);
+            }
+        }
+
+        if (!valid) {
+            throw std::invalid_argument("Compressed arrays are not a valid sparse matrix.");
+        }
+
+        starts = std::move(offsets);
+        inner = std::move(indices);
+        entries = std::move(values);
+    }
+
+    template <SparseLayout L>
+    SparseMatrix<L>::SparseMatrix(const SparseMatrix<transposed>& other) : SparseMatrix(other.rows(), other.columns()) {
+        // the inner indices of other become the outer ones, walking other
+        // in order keeps the new inner indices sorted
+        for (std::int32_t i : other.inner) {
+            starts[i + 1]++;
+        }
+        for (std::size_t k = 0; k < outerCount(); k++) {
+            starts[k + 1] += starts[k];
+        }
+
+        inner.resize(other.nonZeros());
+        entries.resize(other.nonZeros());
+
+        std::vector<std::size_t> next(starts.begin(), starts.end() - 1);
+        for (std::size_t o = 0; o < other.outerCount(); o++) {
+            for (std::size_t e = other.starts[o]; e < other.starts[o + 1]; e++) {
+                std::size_t position = next[other.inner[e]]++;
+                inner[position] = static_cast<std::int32_t>(o);
+                entries[position] = other.entries[e];
+            }
+        }
+    }
+
+    template <SparseLayout L>
+    template <int V, int N>
+    SparseMatrix<L>::SparseMatrix(const TensorT<NumList<V, N>>& dense) : SparseMatrix(N, V) {
+        for (std::size_t o = 0; o < outerCount(); o++) {
+            for (std::size_t i = 0; i < innerCount(); i++) {
+                float value = L == SparseLayout::Rows ? dense[o][i] : dense[i][o];
+                if (value != 0) {
+                    inner.push_back(static_cast<std::int32_t>(i));
+                    entries.push_back(value);
+                }
+            }
+            starts[o + 1] = entries.size();
+        }
+    }
+
+    template <SparseLayout L>
+    std::size_t SparseMatrix<L>::rows() const {
+        return rowCount;
+    }
+
+    template <SparseLayout L>
+    std::size_t SparseMatrix<L>::columns() const {
+        return columnCount;
+    }
+
+    template <SparseLayout L>
+    std::size_t SparseMatrix<L>::nonZeros() const {
+        return entries.size();
+    }
+
+    template <SparseLayout L>
+    std::size_t SparseMatrix<L>::outerCount() const {
+        return L == SparseLayout::Rows ? rowCount : columnCount;
+    }
+
+    template <SparseLayout L>
+    std::size_t SparseMatrix<L>::innerCount() const {
+        return L == SparseLayout::Rows ? columnCount : rowCount;
+    }
+
+    template <SparseLayout L>
+    std::span<const std::size_t> SparseMatrix<L>::offsets() const {
+        return starts;
+    }
+
+    template <SparseLayout L>
+    std::span<const std::int32_t> SparseMatrix<L>::indices() const {
+        return inner;
+    }
+
+    template <SparseLayout L>
+    std::span<const float> SparseMatrix<L>::values() const {
+        return entries;
+    }
+
+    template <SparseLayout L>
+    std::span<float> SparseMatrix<L>::values() {
+        return entries;
+    }
+
+    template <SparseLayout L>
+    float SparseMatrix<L>::at(std::size_t row, std::size_t column) const {
+        if (row >= rowCount || column >= columnCount) {
+            throw std::out_of_range("Sparse index out of range.");
+        }
+
+        std::size_t o = L == SparseLayout::Rows ? row : column;
+        std::int32_t i = static_cast<std::int32_t>(L == SparseLayout::Rows ? column : row);
+
+        auto first = inner.begin() + starts[o];
+        auto last = inner.begin() + starts[o + 1];
+        auto found = std::lower_bound(first, last, i);
+
+        return found != last && *found == i ? entries[found - inner.begin()] : 0.0f;
+    }
+
+    template <SparseLayout L>
+    SparseMatrix<SparseMatrix<L>::transposed> SparseMatrix<L>::transpose() const {
+        SparseMatrix<transposed> result;
+        result.rowCount = columnCount;
+        result.columnCount = rowCount;
+        result.starts = starts;
+        result.inner = inner;
+        result.entries = entries;
+        return result;
+    }
+
+    template <SparseLayout L>
+    DynamicTensor SparseMatrix<L>::dense() const {
+        DynamicTensor result(std::vector<std::size_t>{columnCount, rowCount}, 0.0f);
+        float* out = result.data();
+
+        for (std::size_t o = 0; o < outerCount(); o++) {
+            for (std::size_t e = starts[o]; e < starts[o + 1]; e++) {
+                std::size_t i = static_cast<std::size_t>(inner[e]);
+                if constexpr (L == SparseLayout::Rows) {
+                    out[o * columnCount + i] = entries[e];
+                } else {
+                    out[i * columnCount + o] = entries[e];
+                }
+            }
+        }
+
+        return result;
+    }
+
+    template <SparseLayout L>
+    DynamicTensor SparseMatrix<L>::operator*(const DynamicTensor& rhs) const {
+        const std::vector<std::size_t>& shape = rhs.shape();
+
+        if (rhs.rank() == 1 && shape[0] == columnCount) {
+            DynamicTensor result(std::vector<std::size_t>{rowCount});
+            multiply(seq, *this, rhs.span(), result.span());
+            return result;
+        }
+
+        if (rhs.rank() == 2 && shape[1] == columnCount) {
+            DynamicTensor result(std::vector<std::size_t>{shape[0], rowCount});
+            multiply(seq, *this, rhs.span(), result.span(), shape[0]);
+            return result;
+        }
+
+        throw std::invalid_argument("Shapes do not match.");
+    }
+
+    template <SparseLayout L>
+    template <int... D>
+    DynamicTensor SparseMatrix<L>::operator*(const TensorT<NumList<D...>>& rhs) const {
+        static_assert(sizeof...(D) <= 2, "Sparse matrices multiply vectors and matrices");
+
+        // the view is only read
+        return *this * DynamicTensor::view(const_cast<float*>(rhs.data()), std::vector<std::size_t>{static_cast<std::size_t>(D)...});
+    }
+
+    // sum of values[k] * x[indices[k]] over one compressed row
+    inline float sparseRowDot(const float* values, const std::int32_t* indices, std::size_t n, const float* x) {
+        std::size_t k = 0;
+        float total = 0;
+
+        // rows shorter than a packet, like those of a 5 or 7 point stencil, are
+        // bound by memory and gain nothing from a gather
+        if (n >= Simd::WIDTH) {
+            Simd::Packet acc = Simd::broadcast(0);
+            for (; k + Simd::WIDTH <= n; k += Simd::WIDTH) {
+                acc = Simd::fma(Simd::load(values + k), Simd::gather(x, indices + k), acc);
+            }
+            total = Simd::reduce(acc);
+        }
+
+        for (; k < n; k++) {
+            total += values[k] * x[indices[k]];
+        }
+
+        return total;
+    }
+
+    // calls rows(first, last) over the rows of a CSR matrix, split over the pool
+    // with par once there are PARALLEL_THRESHOLD non zeros times work per entry
+    template <typename Policy, typename F>
+    void sparseRows(const Policy& policy, std::size_t rows, std::size_t work, F&& body) {
+        static_assert(std::is_same_v<Policy, Sequenced> || std::is_same_v<Policy, Parallel>,
+            "Policy must be seq or par");
+
+        if constexpr (std::is_same_v<Policy, Parallel>) {
+            if (work >= PARALLEL_THRESHOLD && rows > 1) {
+                // each chunk of rows holds about PARALLEL_THRESHOLD / 4 of the work
+                std::size_t grain = std::max<std::size_t>(1, PARALLEL_THRESHOLD / 4 * rows / work);
+                policy.threads().parallelFor(0, rows, grain, body);
+                return;
+            }
+        }
+
+        body(0, rows);
+    }
+
+    template <typename Policy, SparseLayout L>
+    void multiply(const Policy& policy, const SparseMatrix<L>& a, std::span<const float> x, std::span<float> y) {
+        if (x.size() != a.columns() || y.size() != a.rows()) {
+            throw std::invalid_argument("Shapes do not match.");
+        }
+
+        const std::size_t* offsets = a.offsets().data();
+        const std::int32_t* indices = a.indices().data();
+        const float* values = a.values().data();
+        const float* in = x.data();
+        float* out = y.data();
+
+        if constexpr (L == SparseLayout::Rows) {
+            sparseRows(policy, a.rows(), a.nonZeros(), [&](std::size_t first, std::size_t last) {
+                for (std::size_t i = first; i < last; i++) {
+                    out[i] = sparseRowDot(values + offsets[i], indices + offsets[i], offsets[i + 1] - offsets[i], in);
+                }
+            });
+        } else {
+            std::fill(y.begin(), y.end(), 0.0f);
+
+            for (std::size_t j = 0; j < a.columns(); j++) {
+                float xj = in[j];
+                for (std::size_t e = offsets[j]; e < offsets[j + 1]; e++) {
+                    out[indices[e]] += values[e] * xj;
+                }
+            }
+        }
+    }
+
+    template <typename Policy, SparseLayout L>
+    void multiply(const Policy& policy, const SparseMatrix<L>& a, std::span<const float> b, std::span<float> c, std::size_t k) {
+        if (b.size() != a.columns() * k || c.size() != a.rows() * k) {
+            throw std::invalid_argument("Shapes do not match.");
+        }
+
+        const std::size_t* offsets = a.offsets().data();
+        const std::int32_t* indices = a.indices().data();
+        const float* values = a.values().data();
+        const float* in = b.data();
+        float* out = c.data();
+
+        // row i of C is the sum of the rows j of B scaled by a_ij
+        if constexpr (L == SparseLayout::Rows) {
+            sparseRows(policy, a.rows(), a.nonZeros() * k, [&](std::size_t first, std::size_t last) {
+                std::fill(out + first * k, out + last * k, 0.0f);
+                for (std::size_t i = first; i < last; i++) {
+                    for (std::size_t e = offsets[i]; e < offsets[i + 1]; e++) {
+                        Simd::axpy(values[e], in + indices[e] * k, out + i * k, k);
+                    }
+                }
+            });
+        } else {
+            std::fill(c.begin(), c.end(), 0.0f);
+
+            for (std::size_t j = 0; j < a.columns(); j++) {
+                for (std::size_t e = offsets[j]; e < offsets[j + 1]; e++) {
+                    Simd::axpy(values[e], in + j * k, out + indices[e] * k, k);
+                }
+            }
+        }
+    }
+}
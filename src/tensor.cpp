@@ -5,87 +5,111 @@
  * @brief Implementations for the TensorT main logic functions
  */
 
+#include <linalg/format.hpp>
 #include <linalg/tensor.hpp>
 
 namespace Linalg {
 
-    template <int ...D>
-    Tensor<D...>::TensorT(std::initializer_list<TensorT<typename PopBack<NumList<D...>>::value>> list) {
-        std::copy(list.begin(), list.end(), data.begin());
+    template <int ...D, typename T>
+    constexpr TensorT<NumList<D...>, T>::TensorT(std::initializer_list<row_type> list) {
+        auto out = elements.begin();
+        for (const row_type& row : list) {
+            out = std::copy(row.data(), row.data() + row_type::count, out);
+        }
     }
 
-    template <int ...D>
-    Tensor<D...>::TensorT(float value) {
-        data.fill(value);
+    template <int ...D, typename T>
+    constexpr TensorT<NumList<D...>, T>::TensorT(T value) {
+        elements.fill(value);
     }
 
-    template <std::size_t N>
-    bool increment(std::array<std::size_t, N>& indices, const std::array<std::size_t, N>& shape) {
-        for (int i = N - 1; i >= 0; --i) {
-            if (++indices[i] < shape[i])
-                return true;
-            indices[i] = 0;
-        }
-        return false;
+    template <int ...D, typename T>
+    constexpr T* TensorT<NumList<D...>, T>::data() {
+        return elements.data();
     }
 
-    template <int D1, int D2, int ...D>
-    TensorT<typename SwapItems<NumList<D...>, D1, D2>::value> __permuteFunc(TensorT<NumList<D...>> tensor) { 
+    template <int ...D, typename T>
+    constexpr const T* TensorT<NumList<D...>, T>::data() const {
+        return elements.data();
+    }
 
-        static_assert(D1 != D2, "Dimentions should not be the same.");
+    template <int ...D, typename T>
+    constexpr std::span<T, TensorT<NumList<D...>, T>::count> TensorT<NumList<D...>, T>::span() {
+        return std::span<T, count>(data(), count);
+    }
 
-        TensorT<typename SwapItems<NumList<D...>, D1, D2>::value> newTensor;
-        std::array<std::size_t, GetSize<NumList<D...>>::value> indices;
-        std::array<std::size_t, GetSize<NumList<D...>>::value> shape_ = tensor.shape();
-        indices.fill(0);
+    template <int ...D, typename T>
+    constexpr std::span<const T, TensorT<NumList<D...>, T>::count> TensorT<NumList<D...>, T>::span() const {
+        return std::span<const T, count>(data(), count);
+    }
 
-        do {
+    template <int ...D, typename T>
+    std::string TensorT<NumList<D...>, T>::string() const {
+        return toString(*this);
+    }
 
-            std::size_t j = indices.size() - 1;
-            while (indices[j] >= shape_[j]) {
-                indices[j] = 0;
-                j -= 1;
-            }
+    // strides of a contiguous tensor with dimensions D1 and D2 exchanged
+    template <int D1, int D2, int ...D>
+    constexpr std::array<std::size_t, sizeof...(D)> permutedStrides() {
+        static_assert(D1 != D2, "Dimentions should not be the same.");
 
-            std::array<std::size_t, GetSize<NumList<D...>>::value> swappedIndices;
-            swappedIndices = indices;
-            std::swap(swappedIndices[D1], swappedIndices[D2]);
+        std::array<std::size_t, sizeof...(D)> strides = contiguousStrides<D...>();
+        std::swap(strides[D1], strides[D2]);
+        return strides;
+    }
 
-            newTensor.getList(swappedIndices) = tensor.getList(indices);
+    // strides of a row of a contiguous tensor, its own strides without the last one
+    template <int ...D>
+    constexpr std::array<std::size_t, sizeof...(D) - 1> rowStrides() {
+        constexpr std::array<std::size_t, sizeof...(D)> strides = contiguousStrides<D...>();
 
-            indices.back() += 1;
-        } while (increment(indices, shape_));
+        std::array<std::size_t, sizeof...(D) - 1> row = {};
+        for (std::size_t k = 0; k < row.size(); k++) {
+            row[k] = strides[k];
+        }
+        return row;
+    }
 
-        return newTensor; 
+    template <int ...D, typename T>
+    template <int D1, int D2>
+    StridedView<typename SwapItems<NumList<D...>, D1, D2>::value, T> TensorT<NumList<D...>, T>::__permute() {
+        return {data(), permutedStrides<D1, D2, D...>()};
     }
 
-    template <int ...D>
-    std::size_t Tensor<D...>::size() const {
-        return GetItem<NumList<D...>, GetSize<NumList<D...>>::value-1>::element;
+    template <int ...D, typename T>
+    template <int D1, int D2>
+    StridedView<typename SwapItems<NumList<D...>, D1, D2>::value, const T> TensorT<NumList<D...>, T>::__permute() const {
+        return {data(), permutedStrides<D1, D2, D...>()};
     }
 
-    template <int ...D>
-    std::array<std::size_t, GetSize<NumList<D...>>::value> Tensor<D...>::shape() const {
-        return {D...};
+    template <int ...D, typename T>
+    constexpr std::size_t TensorT<NumList<D...>, T>::size() const {
+        return ITEMS<D...>[sizeof...(D) - 1];
     }
 
-    template <int ...D>
-    TensorT<typename PopBack<NumList<D...>>::value>& Tensor<D...>::operator[](std::size_t index) {
-        return data[index];
+    template <int ...D, typename T>
+    constexpr std::array<std::size_t, sizeof...(D)> TensorT<NumList<D...>, T>::shape() const {
+        return {D...};
     }
 
-    template <int ...D>
-    const TensorT<typename PopBack<NumList<D...>>::value>& Tensor<D...>::operator[](std::size_t index) const {
-        return data[index];
+    template <int ...D, typename T>
+    constexpr StridedView<typename PopBack<NumList<D...>>::value, T> TensorT<NumList<D...>, T>::operator[](std::size_t index) {
+        return {elements.data() + index * row_type::count, rowStrides<D...>()};
     }
 
-    template <int ...D>
-    float& Tensor<D...>::getList(std::array<std::size_t, GetSize<NumList<D...>>::value> indices) {
-        std::array<std::size_t, GetSize<NumList<D...>>::value-1> newIndices;
+    template <int ...D, typename T>
+    constexpr StridedView<typename PopBack<NumList<D...>>::value, const T> TensorT<NumList<D...>, T>::operator[](std::size_t index) const {
+        return {elements.data() + index * row_type::count, rowStrides<D...>()};
+    }
 
-        for (std::size_t i = 0; i < newIndices.size(); i++) 
-            newIndices[i] = indices[i];
+    template <int ...D, typename T>
+    constexpr T& TensorT<NumList<D...>, T>::getList(std::array<std::size_t, sizeof...(D)> indices) {
+        constexpr std::array<std::size_t, sizeof...(D)> strides = contiguousStrides<D...>();
 
-        return data[indices.back()].getList(newIndices);
+        std::size_t offset = 0;
+        for (std::size_t k = 0; k < indices.size(); k++) {
+            offset += indices[k] * strides[k];
+        }
+        return elements[offset];
     }
 }
\ No newline at end of file
@@ -0,0 +1,313 @@
+/**
+ * @file tensor_file.cpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Implementation for the binary tensor files
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <linalg/memory.hpp>
+#include <linalg/tensor_file.hpp>
+
+namespace Linalg {
+
+    constexpr char TENSOR_FILE_MAGIC[4] = {'L', 'A', 'T', 'F'};
+
+    inline std::uint8_t nativeByteOrder() {
+        return std::endian::native == std::endian::little ? 1 : 2;
+    }
+
+    inline std::size_t dtypeSize(DType dtype) {
+        switch (dtype) {
+            case DType::Float32: return 4;
+            case DType::Float64: return 8;
+            case DType::Float16: return 2;
+            case DType::BFloat16: return 2;
+        }
+        throw std::runtime_error("Unknown tensor file dtype.");
+    }
+
+    inline std::size_t tensorFileDataOffset(std::size_t rank) {
+        std::size_t end = sizeof(TensorFileHeader) + rank * sizeof(std::uint64_t);
+        return (end + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE;
+    }
+
+    // header, shape and padding up to the first element
+    inline void writeTensorFileHeader(std::FILE* file, const std::vector<std::size_t>& shape, DType dtype) {
+        std::size_t count = 1;
+        for (std::size_t d : shape) {
+            count *= d;
+        }
+
+        TensorFileHeader header;
+        std::memcpy(header.magic, TENSOR_FILE_MAGIC, 4);
+        header.version = TENSOR_FILE_VERSION;
+        header.dtype = dtype;
+        header.byteOrder = nativeByteOrder();
+        header.rank = static_cast<std::uint32_t>(shape.size());
+        header.alignment = CACHE_LINE;
+        header.dataOffset = tensorFileDataOffset(shape.size());
+        header.count = count;
+
+        std::vector<std::byte> block(header.dataOffset);
+        std::memcpy(block.data(), &header, sizeof(header));
+        for (std::size_t k = 0; k < shape.size(); k++) {
+            std::uint64_t d = shape[k];
+            std::memcpy(block.data() + sizeof(header) + k * sizeof(d), &d, sizeof(d));
+        }
+
+        if (std::fwrite(block.data(), 1, block.size(), file) != block.size()) {
+            throw std::runtime_error("Could not write the tensor file header.");
+        }
+    }
+
+    inline void writeTensorFile(const std::string& path, const std::vector<std::size_t>& shape, DType dtype,
+        const void* data, std::size_t bytes) {
+        std::FILE* file = std::fopen(path.c_str(), "wb");
+        if (file == nullptr) {
+            throw std::runtime_error("Could not open " + path + " for writing.");
+        }
+
+        try {
+            writeTensorFileHeader(file, shape, dtype);
+            if (std::fwrite(data, 1, bytes, file) != bytes) {
+                throw std::runtime_error("Could not write the tensor file elements.");
+            }
+        } catch (...) {
+            std::fclose(file);
+            throw;
+        }
+
+        if (std::fclose(file) != 0) {
+            throw std::runtime_error("Could not close " + path + ".");
+        }
+    }
+
+    template <int... D, typename T>
+    void saveTensor(const std::string& path, const TensorT<NumList<D...>, T>& tensor) {
+        writeTensorFile(path, {static_cast<std::size_t>(D)...}, DTypeOf<T>::value, tensor.data(), tensor.count * sizeof(T));
+    }
+
+    inline void saveTensor(const std::string& path, const DynamicTensor& tensor) {
+        writeTensorFile(path, tensor.shape(), DType::Float32, tensor.data(), tensor.size() * sizeof(float));
+    }
+
+    template <int... D, typename T>
+    void loadTensor(const std::string& path, TensorT<NumList<D...>, T>& tensor) {
+        MappedTensor file(path);
+        tensor = file.as<T, D...>();
+    }
+
+    inline TensorWriter::TensorWriter(const std::string& path, std::vector<std::size_t> shape, DType dtype)
+        : type(dtype) {
+        file = std::fopen(path.c_str(), "wb");
+        if (file == nullptr) {
+            throw std::runtime_error("Could not open " + path + " for writing.");
+        }
+
+        total = 1;
+        for (std::size_t d : shape) {
+            total *= d;
+        }
+
+        try {
+            writeTensorFileHeader(file, shape, dtype);
+        } catch (...) {
+            std::fclose(file);
+            throw;
+        }
+    }
+
+    // an unfinished file is left behind with a short payload, which MappedTensor refuses
+    inline TensorWriter::~TensorWriter() {
+        if (file != nullptr) {
+            std::fclose(file);
+        }
+    }
+
+    template <typename T>
+    void TensorWriter::write(std::span<const T> elements) {
+        if (DTypeOf<T>::value != type) {
+            throw std::invalid_argument("Element type does not match the dtype of the file.");
+        }
+        if (file == nullptr) {
+            throw std::runtime_error("Tensor file is already closed.");
+        }
+        if (count + elements.size() > total) {
+            throw std::invalid_argument("More elements written than the shape holds.");
+        }
+
+        if (std::fwrite(elements.data(), sizeof(T), elements.size(), file) != elements.size()) {
+            throw std::runtime_error("Could not write the tensor file elements.");
+        }
+        count += elements.size();
+    }
+
+    inline std::size_t TensorWriter::written() const {
+        return count;
+    }
+
+    inline std::size_t TensorWriter::size() const {
+        return total;
+    }
+
+    inline void TensorWriter::close() {
+        if (file == nullptr) {
+            return;
+        }
+
+        int closed = std::fclose(file);
+        file = nullptr;
+
+        if (closed != 0) {
+            throw std::runtime_error("Could not close the tensor file.");
+        }
+        if (count != total) {
+            throw std::runtime_error("Tensor file closed before every element was written.");
+        }
+    }
+
+    inline MappedTensor::MappedTensor(const std::string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Could not open " + path + ".");
+        }
+
+        struct stat status;
+        if (::fstat(fd, &status) != 0 || static_cast<std::size_t>(status.st_size) < sizeof(TensorFileHeader)) {
+            ::close(fd);
+            throw std::runtime_error(path + " is not a tensor file.");
+        }
+
+        length = static_cast<std::size_t>(status.st_size);
+        mapping = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+
+        if (mapping == MAP_FAILED) {
+            mapping = nullptr;
+            throw std::runtime_error("Could not map " + path + ".");
+        }
+
+        try {
+            TensorFileHeader header;
+            std::memcpy(&header, mapping, sizeof(header));
+
+            if (std::memcmp(header.magic, TENSOR_FILE_MAGIC, 4) != 0) {
+                throw std::runtime_error(path + " is not a tensor file.");
+            }
+            if (header.version > TENSOR_FILE_VERSION) {
+                throw std::runtime_error(path + " was written by a newer version of the format.");
+            }
+            if (header.byteOrder != nativeByteOrder()) {
+                throw std::runtime_error(path + " was written with a different byte order.");
+            }
+
+            type = header.dtype;
+            std::size_t shapeEnd = sizeof(header) + header.rank * sizeof(std::uint64_t);
+            if (shapeEnd > length || header.dataOffset < shapeEnd || header.dataOffset % CACHE_LINE != 0) {
+                throw std::runtime_error(path + " has a corrupt header.");
+            }
+
+            std::size_t count = 1;
+            dims.resize(header.rank);
+            for (std::size_t k = 0; k < header.rank; k++) {
+                std::uint64_t d;
+                std::memcpy(&d, static_cast<std::byte*>(mapping) + sizeof(header) + k * sizeof(d), sizeof(d));
+                dims[k] = d;
+                count *= d;
+            }
+
+            if (count != header.count || header.dataOffset + count * dtypeSize(type) > length) {
+                throw std::runtime_error(path + " is truncated.");
+            }
+
+            elements = static_cast<std::byte*>(mapping) + header.dataOffset;
+        } catch (...) {
+            release();
+            throw;
+        }
+    }
+
+    inline MappedTensor::MappedTensor(MappedTensor&& other) noexcept
+        : mapping(std::exchange(other.mapping, nullptr)), length(std::exchange(other.length, 0)),
+          elements(std::exchange(other.elements, nullptr)), dims(std::move(other.dims)), type(other.type) {}
+
+    inline MappedTensor& MappedTensor::operator=(MappedTensor&& other) noexcept {
+        if (this != &other) {
+            release();
+            mapping = std::exchange(other.mapping, nullptr);
+            length = std::exchange(other.length, 0);
+            elements = std::exchange(other.elements, nullptr);
+            dims = std::move(other.dims);
+            type = other.type;
+        }
+        return *this;
+    }
+
+    inline MappedTensor::~MappedTensor() {
+        release();
+    }
+
+    inline void MappedTensor::release() {
+        if (mapping != nullptr) {
+            ::munmap(mapping, length);
+        }
+        mapping = nullptr;
+        elements = nullptr;
+        length = 0;
+    }
+
+    inline const std::vector<std::size_t>& MappedTensor::shape() const {
+        return dims;
+    }
+
+    inline DType MappedTensor::dtype() const {
+        return type;
+    }
+
+    inline std::size_t MappedTensor::size() const {
+        std::size_t count = 1;
+        for (std::size_t d : dims) {
+            count *= d;
+        }
+        return count;
+    }
+
+    template <typename T>
+    std::span<T> MappedTensor::span() {
+        if (DTypeOf<T>::value != type) {
+            throw std::invalid_argument("Element type does not match the dtype of the file.");
+        }
+
+        return {reinterpret_cast<T*>(elements), size()};
+    }
+
+    template <typename T, int... D>
+    TensorT<NumList<D...>, T>& MappedTensor::as() {
+        // the data starts on a cache line, so the padding of a tensor of a cache line or
+        // more ends on the last page of the mapping, which reads as zeros past the file
+        if (dims != std::vector<std::size_t>{static_cast<std::size_t>(D)...}) {
+            throw std::invalid_argument("Shapes do not match.");
+        }
+        if (reinterpret_cast<std::uintptr_t>(elements) % alignof(TensorT<NumList<D...>, T>) != 0) {
+            throw std::invalid_argument("Buffer is not aligned for the tensor.");
+        }
+
+        return *reinterpret_cast<TensorT<NumList<D...>, T>*>(span<T>().data());
+    }
+
+    inline DynamicTensor MappedTensor::view() {
+        return DynamicTensor::view(span<float>().data(), dims);
+    }
+}
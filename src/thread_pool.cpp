@@ -0,0 +1,191 @@
+/**
+ * @file thread_pool.cpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Implementation for the thread pool
+ */
+
+#include <atomic>
+#include <exception>
+
+#include <linalg/thread_pool.hpp>
+
+namespace Linalg {
+
+    // the pool and queue index of the current worker thread, if it is one
+    inline thread_local const ThreadPool* currentPool = nullptr;
+    inline thread_local std::size_t currentQueue = 0;
+
+    inline ThreadPool::ThreadPool(std::size_t workers) {
+        for (std::size_t i = 0; i < workers + 1; i++) {
+            queues.push_back(std::make_unique<Queue>());
+        }
+
+        for (std::size_t i = 0; i < workers; i++) {
+            threads.emplace_back([this, i] { work(i); });
+        }
+    }
+
+    inline ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            stopping = true;
+        }
+
+        available.notify_all();
+
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+
+    inline ThreadPool& ThreadPool::instance() {
+        static ThreadPool pool(std::thread::hardware_concurrency() > 1
+            ? std::thread::hardware_concurrency() - 1 : 0);
+        return pool;
+    }
+
+    inline std::size_t ThreadPool::concurrency() const {
+        return threads.size() + 1;
+    }
+
+    inline std::size_t ThreadPool::ownQueue() const {
+        return currentPool == this ? currentQueue : threads.size();
+    }
+
+    inline void ThreadPool::submit(std::function<void()> task) {
+        Queue& queue = *queues[ownQueue()];
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.tasks.push_back(std::move(task));
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            pending.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        available.notify_one();
+    }
+
+    inline bool ThreadPool::pop(std::size_t index, bool newest, std::function<void()>& task) {
+        Queue& queue = *queues[index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+
+        if (queue.tasks.empty()) {
+            return false;
+        }
+
+        if (newest) {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+        } else {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+        }
+
+        pending.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // the newest task of our own queue is the most likely to be in cache,
+    // other queues are robbed of their oldest, which is usually the largest
+    inline bool ThreadPool::runOne() {
+        std::function<void()> task;
+        std::size_t own = ownQueue();
+
+        bool found = pop(own, true, task);
+
+        std::size_t start = nextVictim.fetch_add(1, std::memory_order_relaxed);
+        for (std::size_t i = 0; !found && i < queues.size(); i++) {
+            std::size_t victim = (start + i) % queues.size();
+            if (victim != own) {
+                found = pop(victim, false, task);
+            }
+        }
+
+        if (found) {
+            task();
+        }
+        return found;
+    }
+
+    inline void ThreadPool::work(std::size_t index) {
+        currentPool = this;
+        currentQueue = index;
+
+        while (true) {
+            if (runOne()) {
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            available.wait(lock, [this] { return stopping || pending.load(std::memory_order_relaxed) > 0; });
+            if (stopping && pending.load(std::memory_order_relaxed) == 0) {
+                return;
+            }
+        }
+    }
+
+    template <typename F>
+    void ThreadPool::parallelFor(std::size_t begin, std::size_t end, std::size_t grain, F&& body) {
+        if (end <= begin) {
+            return;
+        }
+
+        // a few chunks per thread, so threads that finish early can steal the rest
+        std::size_t n = end - begin;
+        std::size_t chunks = grain > 0 ? (n + grain - 1) / grain : n;
+        if (chunks > 4 * concurrency()) {
+            chunks = 4 * concurrency();
+        }
+
+        if (chunks <= 1 || concurrency() == 1) {
+            body(begin, end);
+            return;
+        }
+
+        std::size_t chunk = (n + chunks - 1) / chunks;
+        std::atomic<std::size_t> remaining(chunks - 1);
+
+        // the first exception of any chunk is rethrown once every chunk has finished,
+        // the queued tasks reference body and remaining on this stack frame
+        std::exception_ptr error;
+        std::mutex errorMutex;
+        auto run = [&body, &error, &errorMutex](std::size_t first, std::size_t last) {
+            try {
+                body(first, last);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        };
+
+        for (std::size_t c = 1; c < chunks; c++) {
+            std::size_t first = begin + c * chunk;
+            std::size_t last = first + chunk < end ? first + chunk : end;
+
+            submit([&run, &remaining, first, last] {
+                if (first < last) {
+                    run(first, last);
+                }
+                remaining.fetch_sub(1, std::memory_order_release);
+            });
+        }
+
+        run(begin, begin + chunk);
+
+        // help with queued work instead of blocking, so nested calls cannot deadlock
+        while (remaining.load(std::memory_order_acquire) > 0) {
+            if (!runOne()) {
+                std::this_thread::yield();
+            }
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
@@ -0,0 +1,110 @@
+/**
+ * @file transform.cpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Implementation for the batched transforms
+ */
+
+#include <stdexcept>
+#include <type_traits>
+
+#include <linalg/simd.hpp>
+#include <linalg/thread_pool.hpp>
+#include <linalg/transform.hpp>
+
+namespace Linalg {
+
+    enum class TransformW { Point, Direction, Given };
+
+    template <typename V, TransformW W>
+    void transformRange(const Mat4& matrix, const V* in, V* out, std::size_t count) {
+        constexpr int D = sizeof(V) / sizeof(float);
+        static_assert(std::is_base_of_v<Vector<D>, V> && (D == 3 || D == 4),
+            "Only 3 and 4 component vectors can be transformed by a Mat4");
+        static_assert(TRANSFORM_BLOCK % Simd::WIDTH == 0);
+
+        Simd::Packet m[4][4];
+        for (int r = 0; r < 4; r++) {
+            for (int c = 0; c < 4; c++) {
+                m[r][c] = Simd::broadcast(matrix[r][c]);
+            }
+        }
+
+        alignas(64) float soa[4][TRANSFORM_BLOCK];
+        alignas(64) float result[D][TRANSFORM_BLOCK];
+
+        for (std::size_t start = 0; start < count; start += TRANSFORM_BLOCK) {
+            std::size_t n = count - start < TRANSFORM_BLOCK ? count - start : TRANSFORM_BLOCK;
+            std::size_t padded = (n + Simd::WIDTH - 1) / Simd::WIDTH * Simd::WIDTH;
+
+            for (std::size_t i = 0; i < padded; i++) {
+                bool valid = i < n;
+                for (int c = 0; c < 3; c++) {
+                    soa[c][i] = valid ? in[start + i][c] : 0.0f;
+                }
+
+                if constexpr (W == TransformW::Given) {
+                    soa[3][i] = valid ? in[start + i][3] : 0.0f;
+                }
+            }
+
+            for (std::size_t i = 0; i < padded; i += Simd::WIDTH) {
+                Simd::Packet x = Simd::load(soa[0] + i);
+                Simd::Packet y = Simd::load(soa[1] + i);
+                Simd::Packet z = Simd::load(soa[2] + i);
+
+                for (int r = 0; r < D; r++) {
+                    Simd::Packet acc = Simd::fma(m[r][0], x, Simd::fma(m[r][1], y, Simd::mul(m[r][2], z)));
+
+                    if constexpr (W == TransformW::Point) {
+                        acc = Simd::add(acc, m[r][3]);
+                    } else if constexpr (W == TransformW::Given) {
+                        acc = Simd::fma(m[r][3], Simd::load(soa[3] + i), acc);
+                    }
+
+                    Simd::store(result[r] + i, acc);
+                }
+            }
+
+            for (std::size_t i = 0; i < n; i++) {
+                for (int r = 0; r < D; r++) {
+                    out[start + i][r] = result[r][i];
+                }
+            }
+        }
+    }
+
+    template <typename V, TransformW W>
+    void transformSpan(const Mat4& matrix, std::span<const V> in, std::span<V> out) {
+        if (out.size() < in.size()) {
+            throw std::invalid_argument("Output span is smaller than the input span.");
+        }
+
+        if (in.size() < TRANSFORM_PARALLEL_THRESHOLD) {
+            transformRange<V, W>(matrix, in.data(), out.data(), in.size());
+            return;
+        }
+
+        ThreadPool::instance().parallelFor(0, in.size(), TRANSFORM_PARALLEL_THRESHOLD / 4,
+            [&](std::size_t first, std::size_t last) {
+                transformRange<V, W>(matrix, in.data() + first, out.data() + first, last - first);
+            });
+    }
+
+    template <typename V>
+    void transformPoints(const Mat4& matrix, std::span<const V> in, std::span<V> out) {
+        transformSpan<V, TransformW::Point>(matrix, in, out);
+    }
+
+    template <typename V>
+    void transformDirections(const Mat4& matrix, std::span<const V> in, std::span<V> out) {
+        transformSpan<V, TransformW::Direction>(matrix, in, out);
+    }
+
+    template <typename V>
+    void transform(const Mat4& matrix, std::span<const V> in, std::span<V> out) {
+        static_assert(sizeof(V) == 4 * sizeof(float), "transform needs a w component, use transformPoints");
+
+        transformSpan<V, TransformW::Given>(matrix, in, out);
+    }
+}
\ No newline at end of file
@@ -5,104 +5,128 @@
  * @brief Implementations for the vector functions
  */
 
+#include <linalg/format.hpp>
 #include <linalg/vector.hpp>
 
 namespace Linalg {
 
-    template <int D>
-    Vector<D>::TensorT(std::initializer_list<float> list) {
-        std::copy(list.begin(), list.end(), data.begin());
+    template <int D, typename T>
+    constexpr Vector<D, T>::TensorT(std::initializer_list<T> list) {
+        std::copy(list.begin(), list.end(), elements.begin());
     }
 
-    template <int D>
-    Vector<D>::TensorT(float value) {
-        data.fill(value);
+    template <int D, typename T>
+    constexpr Vector<D, T>::TensorT(T value) {
+        elements.fill(value);
     }
 
-    template <int D>
-    float& Vector<D>::operator[](std::size_t index) {
-        return data[index];
+    template <int D, typename T>
+    constexpr T& Vector<D, T>::operator[](std::size_t index) {
+        return elements[index];
     }
 
-    template <int D>
-    const float& Vector<D>::operator[](std::size_t index) const {
-        return data[index];
+    template <int D, typename T>
+    constexpr const T& Vector<D, T>::operator[](std::size_t index) const {
+        return elements[index];
     }
 
-    template <int D>
-    float Vector<D>::dot(const TensorT& b) const {
-        float sum = 0.0f;
+    template <int D, typename T>
+    constexpr T* Vector<D, T>::data() {
+        return elements.data();
+    }
+
+    template <int D, typename T>
+    constexpr const T* Vector<D, T>::data() const {
+        return elements.data();
+    }
+
+    template <int D, typename T>
+    constexpr std::span<T, D> Vector<D, T>::span() {
+        return elements;
+    }
+
+    template <int D, typename T>
+    constexpr std::span<const T, D> Vector<D, T>::span() const {
+        return elements;
+    }
+
+    template <int D, typename T>
+    constexpr Accumulator<T> Vector<D, T>::dot(const TensorT& b) const {
+        if constexpr (std::is_same_v<T, float>) {
+            if (!std::is_constant_evaluated()) {
+                return Simd::dot(data(), b.data(), D);
+            }
+        }
+
+        Accumulator<T> sum = 0;
         for (int i = 0; i < D; ++i)
-        sum += this->operator[](i)* b[i];
+        sum += static_cast<Accumulator<T>>(elements[i]) * static_cast<Accumulator<T>>(b[i]);
         return sum;
     }
     
-    template <int D>
-    float Vector<D>::sum() const {
-        float sum = 0.0f;
+    template <int D, typename T>
+    constexpr Accumulator<T> Vector<D, T>::sum() const {
+        if constexpr (std::is_same_v<T, float>) {
+            if (!std::is_constant_evaluated()) {
+                return Simd::sum(data(), D);
+            }
+        }
+
+        Accumulator<T> sum = 0;
         for (int i = 0; i < D; ++i)
-        sum += this->operator[](i);
+        sum += elements[i];
         return sum;
     }
     
-    template <int D>
-    float Vector<D>::squaredLength() const {
+    template <int D, typename T>
+    constexpr Accumulator<T> Vector<D, T>::squaredLength() const {
         return dot(*this);
     }
     
-    template <int D>
-    float Vector<D>::length() const {
-        return std::sqrt(squaredLength());
+    template <int D, typename T>
+    T Vector<D, T>::length() const {
+        return static_cast<T>(std::sqrt(squaredLength()));
     }
     
-    template <int D>
-    float& Vector<D>::getList(std::array<std::size_t, GetSize<NumList<D>>::value> indices) {
-        return data[indices.back()];
+    template <int D, typename T>
+    constexpr T& Vector<D, T>::getList(std::array<std::size_t, GetSize<NumList<D>>::value> indices) {
+        return elements[indices.back()];
     }
     
-    template <int D>
-    std::size_t Vector<D>::size() const {
+    template <int D, typename T>
+    constexpr std::size_t Vector<D, T>::size() const {
         return D;
     }
     
-    template <int D>
-    std::string Vector<D>::string() const {
-        std::stringstream stream;
-        stream << "(";
-        
-        for (std::size_t i = 0; i < data.size() - 1; i++) {
-            stream << std::fixed << std::setprecision(6) << data[i] << ", ";
-        }
-        
-        stream << std::fixed << std::setprecision(6) << data.back() << ")";
-        
-        return stream.str();
+    template <int D, typename T>
+    std::string Vector<D, T>::string() const {
+        return toString(*this);
     }
     
-    template <int D>
-    Vector<D> Vector<D>::lerp(Vector<D> to, float t) const {
+    template <int D, typename T>
+    constexpr Vector<D, T> Vector<D, T>::lerp(Vector<D, T> to, T t) const {
         return *this * (1 - t) + to * t;
     }
     
-    template <int D>
-    Vector<D> Vector<D>::cross(Vector<D> other) const {
+    template <int D, typename T>
+    constexpr Vector<D, T> Vector<D, T>::cross(const Vector<D, T>& other) const {
         static_assert(D == 3, "cross product only exits for a vector 3");
         
-        return {
-            data[1] * other.data[2] - data[2] * other.data[1],
-            data[2] * other.data[0] - data[0] * other.data[2],
-            data[0] * other.data[1] - data[1] * other.data[0],
-        };
+        Vector<D, T> result;
+        result.elements[0] = elements[1] * other.elements[2] - elements[2] * other.elements[1];
+        result.elements[1] = elements[2] * other.elements[0] - elements[0] * other.elements[2];
+        result.elements[2] = elements[0] * other.elements[1] - elements[1] * other.elements[0];
+        return result;
     }
     
-    template <int D>
-    Vector<D> Vector<D>::normalize() const {
-        return this->operator/(length());
+    template <int D, typename T>
+    Vector<D, T> Vector<D, T>::normalize() const {
+        return *this / length();
     }
     
-    template <int D>
-    Vector<D+1> Vector<D>::extend(float value) const {
-        Vector<D+1> extended;
+    template <int D, typename T>
+    constexpr Vector<D+1, T> Vector<D, T>::extend(T value) const {
+        Vector<D+1, T> extended;
         for (std::size_t i = 0; i < D; ++i)
         extended[i] = this->operator[](i);
         extended[D] = value;
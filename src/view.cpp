@@ -0,0 +1,277 @@
+/**
+ * @file view.cpp
+ * @author lukem
+ * @date 2025-11-28
+ * @brief Implementation for the strided tensor views
+ */
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include <linalg/view.hpp>
+
+namespace Linalg {
+
+    template <int... D, typename T>
+    constexpr StridedView<NumList<D...>, T>::StridedView(T* data, std::array<std::size_t, sizeof...(D)> strides)
+        : elements(data), steps(strides) {}
+
+    template <int... D, typename T>
+    constexpr const StridedView<NumList<D...>, T>& StridedView<NumList<D...>, T>::operator=(const StridedView& other) const {
+        return this->operator=<StridedView>(other);
+    }
+
+    template <int... D, typename T>
+    constexpr const StridedView<NumList<D...>, T>& StridedView<NumList<D...>, T>::operator=(const value_type& rhs) const {
+        return this->operator=<value_type>(rhs);
+    }
+
+    template <int... D, typename T>
+    template <typename E, EnableCompound<E, TensorT<NumList<D...>, std::remove_const_t<T>>>>
+    constexpr const StridedView<NumList<D...>, T>& StridedView<NumList<D...>, T>::operator=(const E& rhs) const {
+        static_assert(!std::is_const_v<T>, "Cannot assign through a view of a const tensor.");
+        typedef std::remove_const_t<T> S;
+
+        // v = v.permute(0, 1) through a view reads what it overwrites, so go through a copy
+        if constexpr (!IsScalar<E>::value) {
+            if (!std::is_constant_evaluated() && operandAliases(rhs, *this)) {
+                return assignCopy(rhs);
+            }
+        }
+
+        // the rows of a tensor are contiguous and take the packet path of a Vector
+        if constexpr (rank == 1 && IsExpression<E>::value) {
+            if (steps[0] == 1) {
+                evaluate(elements, rhs);
+                return *this;
+            }
+        }
+
+        for (std::size_t i = 0; i < size(); i++) {
+            if constexpr (rank == 1) {
+                elements[i * steps[0]] = static_cast<S>(elementAt(rhs, i));
+            } else {
+                (*this)[i] = elementAt(rhs, i);
+            }
+        }
+        return *this;
+    }
+
+    template <int... D, typename T>
+    template <typename E>
+    const StridedView<NumList<D...>, T>& StridedView<NumList<D...>, T>::assignCopy(const E& rhs) const {
+        typedef std::remove_const_t<T> S;
+
+        std::vector<S> copy(value_type::count);
+        if constexpr (IsExpression<E>::value) {
+            evaluateTo(copy.data(), rhs);
+        } else {
+            std::copy(rhs.data(), rhs.data() + value_type::count, copy.begin());
+        }
+        return *this = StridedView<NumList<D...>, const S>(copy.data(), contiguousStrides<D...>());
+    }
+
+    template <int... D, typename T>
+    constexpr typename StridedView<NumList<D...>, T>::subscript_type StridedView<NumList<D...>, T>::operator[](std::size_t index) const {
+        if constexpr (rank == 1) {
+            return elements[index * steps[0]];
+        } else {
+            std::array<std::size_t, rank - 1> inner = {};
+            std::copy(steps.begin(), steps.end() - 1, inner.begin());
+            return {elements + index * steps.back(), inner};
+        }
+    }
+
+    template <int... D, typename T>
+    constexpr T& StridedView<NumList<D...>, T>::at(std::array<std::size_t, sizeof...(D)> indices) const {
+        std::size_t offset = 0;
+        for (std::size_t k = 0; k < rank; k++) {
+            offset += indices[k] * steps[k];
+        }
+        return elements[offset];
+    }
+
+    template <int... D, typename T>
+    Simd::Packet StridedView<NumList<D...>, T>::packet(std::size_t index) const {
+        static_assert(rank == 1, "Packets are only read from rank 1 views");
+
+        if (steps[0] == 1) {
+            return Simd::load(elements + index);
+        }
+
+        alignas(64) float lanes[Simd::WIDTH];
+        for (std::size_t l = 0; l < Simd::WIDTH; l++) {
+            lanes[l] = elements[(index + l) * steps[0]];
+        }
+        return Simd::load(lanes);
+    }
+
+    template <int... D, typename T>
+    constexpr std::array<std::size_t, sizeof...(D)> StridedView<NumList<D...>, T>::shape() const {
+        return {D...};
+    }
+
+    template <int... D, typename T>
+    constexpr const std::array<std::size_t, sizeof...(D)>& StridedView<NumList<D...>, T>::strides() const {
+        return steps;
+    }
+
+    template <int... D, typename T>
+    constexpr T* StridedView<NumList<D...>, T>::data() const {
+        return elements;
+    }
+
+    template <int... D, typename T>
+    template <int D1, int D2>
+    StridedView<typename SwapItems<NumList<D...>, D1, D2>::value, T> StridedView<NumList<D...>, T>::__permute() const {
+        static_assert(D1 != D2, "Dimentions should not be the same.");
+
+        std::array<std::size_t, rank> swapped = steps;
+        std::swap(swapped[D1], swapped[D2]);
+        return {elements, swapped};
+    }
+
+    // one past the furthest element a view of dimensions D with these strides reaches
+    template <int... D>
+    constexpr std::size_t viewExtent(const std::array<std::size_t, sizeof...(D)>& strides) {
+        constexpr std::array<std::size_t, sizeof...(D)> dims = {D...};
+        std::size_t extent = 1;
+        for (std::size_t k = 0; k < sizeof...(D); k++) {
+            extent += (dims[k] - 1) * strides[k];
+        }
+        return extent;
+    }
+
+    template <int... D, typename T>
+    template <typename Out>
+    constexpr bool StridedView<NumList<D...>, T>::aliases(const Out& out) const {
+        typedef std::remove_const_t<T> S;
+
+        const S* outData = out.data();
+        std::size_t outExtent;
+        if constexpr (IsExpression<Out>::value) {
+            // the same elements in the same order are read before they are written
+            if (outData == elements && out.strides() == steps) {
+                return false;
+            }
+            outExtent = viewExtent<D...>(out.strides());
+        } else {
+            if (outData == elements && contiguousStrides<D...>() == steps) {
+                return false;
+            }
+            outExtent = Out::count;
+        }
+
+        const S* inData = elements;
+        std::size_t extent = viewExtent<D...>(steps);
+        return std::less<const S*>()(inData, outData + outExtent) && std::less<const S*>()(outData, inData + extent);
+    }
+
+    template <int... D, typename T>
+    typename StridedView<NumList<D...>, T>::value_type StridedView<NumList<D...>, T>::eval() const {
+        return value_type(*this);
+    }
+
+    template <int... D, typename T>
+    void StridedView<NumList<D...>, T>::copyTo(std::remove_const_t<T>* out, std::size_t first, std::size_t last) const {
+        if (first >= last) {
+            return;
+        }
+
+        constexpr std::array<std::size_t, rank> dims = {D...};
+
+        std::array<std::size_t, rank> outSteps;
+        std::size_t step = 1;
+        for (std::size_t k = 0; k < rank; k++) {
+            outSteps[k] = step;
+            step *= dims[k];
+        }
+
+        std::array<std::size_t, rank> lo = {};
+        std::array<std::size_t, rank> hi = dims;
+        lo[rank - 1] = first;
+        hi[rank - 1] = last;
+
+        // the output is written along dimension 0, if the source is read along
+        // another dimension p both are walked in square tiles of dimensions 0 and p
+        std::size_t p = 0;
+        for (std::size_t k = 1; k < rank; k++) {
+            if (steps[k] < steps[p]) {
+                p = k;
+            }
+        }
+
+        std::array<std::size_t, rank> index = lo;
+        while (true) {
+            std::size_t in = 0;
+            std::size_t o = 0;
+            for (std::size_t k = 0; k < rank; k++) {
+                if (k != 0 && k != p) {
+                    in += index[k] * steps[k];
+                    o += index[k] * outSteps[k];
+                }
+            }
+
+            if (p == 0) {
+                for (std::size_t i = lo[0]; i < hi[0]; i++) {
+                    out[o + i] = elements[in + i * steps[0]];
+                }
+            } else {
+                for (std::size_t jt = lo[p]; jt < hi[p]; jt += VIEW_TILE) {
+                    std::size_t jEnd = std::min(jt + VIEW_TILE, hi[p]);
+
+                    for (std::size_t it = lo[0]; it < hi[0]; it += VIEW_TILE) {
+                        std::size_t iEnd = std::min(it + VIEW_TILE, hi[0]);
+
+                        for (std::size_t j = jt; j < jEnd; j++) {
+                            for (std::size_t i = it; i < iEnd; i++) {
+                                out[o + j * outSteps[p] + i] = elements[in + j * steps[p] + i * steps[0]];
+                            }
+                        }
+                    }
+                }
+            }
+
+            // odometer over the dimensions outside the tile
+            std::size_t k = 1;
+            for (; k < rank; k++) {
+                if (k == p) {
+                    continue;
+                }
+                if (++index[k] < hi[k]) {
+                    break;
+                }
+                index[k] = lo[k];
+            }
+
+            if (k >= rank) {
+                break;
+            }
+        }
+    }
+
+    template <typename T, typename E>
+    void evaluateTo(T* out, const E& expression) {
+        typedef typename E::value_type Result;
+
+        if constexpr (IsStridedView<E>::value) {
+            expression.copyTo(out);
+        } else if constexpr (TensorExtent<Result>::rank == 1) {
+            evaluate(out, expression);
+        } else if constexpr (IsFlat<E>::value) {
+            evaluateFlat(out, expression, 0, Result::count);
+        } else {
+            evaluateRows(out, expression);
+        }
+    }
+
+    template <typename T, typename E>
+    void evaluateCopy(T* out, const E& expression) {
+        constexpr std::size_t count = E::value_type::count;
+
+        std::vector<T> copy(count);
+        evaluateTo(copy.data(), expression);
+        std::copy(copy.begin(), copy.end(), out);
+    }
+}
\ No newline at end of file
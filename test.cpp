@@ -1,5 +1,14 @@
 #include <linalg/linalg.hpp>
 
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
 int main(void) {
 
     Linalg::Tensor<2, 3, 2> t;
@@ -10,7 +19,923 @@ int main(void) {
 
     la::Vec2 v1 = {1, 0};
     la::Vec2 v2 = 1;
-    v2.x = 2;
+    v2.x() = 2;
+    assert(v2[0] == 2 && v2.y() == 1);
 
     (void)v1;
-}
\ No newline at end of file
+
+    la::Vec3 p1 = {1, 2, 3};
+    la::Vec3 p2 = p1;
+    p1.z() = 7;
+    assert(p2.z() == 3 && p1.z() == 7);
+
+    la::Matrix<2, 3> a = {{1, 2, 3}, {4, 5, 6}};
+    la::Matrix<3, 2> b = {{7, 8}, {9, 10}, {11, 12}};
+    la::Matrix<2, 2> ab = a * b;
+    assert(ab[0][0] == 58 && ab[0][1] == 64);
+    assert(ab[1][0] == 139 && ab[1][1] == 154);
+
+    la::Mat4 m = la::Mat4::identity();
+    m[0][3] = 5;
+    la::Mat4 mm = m * m;
+    assert(mm[0][3] == 10 && mm[3][3] == 1);
+
+    la::Tensor<5, 40, 37> grid;
+    for (int k = 0; k < 37; k++)
+        for (int j = 0; j < 40; j++)
+            for (int i = 0; i < 5; i++)
+                grid[k][j][i] = i + 10 * j + 1000 * k;
+    la::Tensor<37, 40, 5> gridT = grid.permute(0, 2);
+    la::Tensor<5, 37, 40> gridU = grid.permute(1, 2);
+    assert(gridT[4][39][36] == 4 + 390 + 36000 && gridT[2][7][11] == 2 + 70 + 11000);
+    assert(gridU[39][36][4] == 4 + 390 + 36000 && gridU[7][11][2] == 2 + 70 + 11000);
+    la::Tensor<40, 37, 5> gridV = grid.permute(0, 2).permute(0, 1);
+    assert(gridV[4][36][39] == 4 + 390 + 36000);
+    la::Tensor<37, 40, 5> gridSum = grid.permute(0, 2) + gridT;
+    assert(gridSum[3][20][10] == 2 * (3 + 200 + 10000));
+    assert(grid.permute(0, 2).at({11, 7, 2}) == 2 + 70 + 11000);
+
+    la::Matrix<3, 2> aT = a.transpose();
+    assert(aT[2][0] == 3 && aT[0][1] == 4);
+    la::Mat4 square = mm;
+    square = square.transpose();
+    assert(square[3][0] == 10 && square[0][3] == 0);
+    la::Tensor<3, 3> selfSum = {{0, 1, 2}, {3, 4, 5}, {6, 7, 8}};
+    selfSum = selfSum.permute(0, 1) + selfSum;
+    assert(selfSum[0][1] == 4 && selfSum[1][0] == 4 && selfSum[2][0] == 8 && selfSum[0][2] == 8 && selfSum[1][1] == 8);
+
+    la::Tensor<2, 2> cab = la::contract<la::Labels<'k', 'i'>, la::Labels<'j', 'k'>, la::Labels<'j', 'i'>>(a, b);
+    assert(cab[0][0] == 58 && cab[1][0] == 139 && cab[1][1] == 154);
+    la::Tensor<2, 2> cabT = la::contract<la::Labels<'k', 'i'>, la::Labels<'j', 'k'>, la::Labels<'i', 'j'>>(a, b);
+    assert(cabT[0][1] == 139 && cabT[1][0] == 64);
+    assert((la::contract<la::Labels<'i', 'j'>, la::Labels<'i', 'j'>, la::Labels<>>(a, a)) == 91);
+
+    // T_xyz W_zw -> R_wyx, then a batched contraction over y
+    la::Tensor<3, 4, 5> t3;
+    la::Tensor<5, 6> w2;
+    for (int z = 0; z < 5; z++)
+        for (int y = 0; y < 4; y++)
+            for (int x = 0; x < 3; x++)
+                t3[z][y][x] = x - 2 * y + 3 * z;
+    for (int q = 0; q < 6; q++)
+        for (int z = 0; z < 5; z++)
+            w2[q][z] = z * q - 1;
+    la::Tensor<6, 4, 3> r3 = la::contract<la::Labels<'x', 'y', 'z'>, la::Labels<'z', 'w'>, la::Labels<'w', 'y', 'x'>>(t3, w2);
+    la::Tensor<3, 3, 4> g3 = la::contract<la::Labels<'x', 'y', 'z'>, la::Labels<'v', 'y', 'z'>, la::Labels<'x', 'v', 'y'>>(t3, t3);
+    for (int q = 0; q < 6; q++)
+        for (int y = 0; y < 4; y++)
+            for (int x = 0; x < 3; x++) {
+                float expected = 0;
+                for (int z = 0; z < 5; z++)
+                    expected += t3[z][y][x] * w2[q][z];
+                assert(r3[x][y][q] == expected);
+            }
+    for (int y = 0; y < 4; y++)
+        for (int v = 0; v < 3; v++)
+            for (int x = 0; x < 3; x++) {
+                float expected = 0;
+                for (int z = 0; z < 5; z++)
+                    expected += t3[z][y][x] * t3[z][y][v];
+                assert(g3[y][v][x] == expected);
+            }
+
+    // reductions remove one dimension, t3 holds x - 2y + 3z
+    la::Tensor<4, 5> sumX = la::sum<0>(t3);
+    la::Tensor<3, 5> sy = la::sum<1>(t3);
+    la::Tensor<3, 4> mz = la::mean<2>(t3);
+    la::Tensor<3, 4> hz = la::max<2>(t3);
+    la::Tensor<4, 5> ly = la::min<0>(t3);
+    for (int z = 0; z < 5; z++)
+        for (int y = 0; y < 4; y++) {
+            assert(sumX[z][y] == 3 - 6 * y + 9 * z);
+            assert(ly[z][y] == -2 * y + 3 * z);
+        }
+    for (int z = 0; z < 5; z++)
+        for (int x = 0; x < 3; x++)
+            assert(sy[z][x] == 4 * x - 12 + 12 * z);
+    for (int y = 0; y < 4; y++)
+        for (int x = 0; x < 3; x++) {
+            assert(mz[y][x] == x - 2 * y + 6);
+            assert(hz[y][x] == x - 2 * y + 12);
+        }
+    la::Vector<4> toNorm({3, 4, 0, 0});
+    assert(la::sum<0>(toNorm) == 7 && la::norm<0>(toNorm) == 5 && la::norm(toNorm) == 5);
+    assert(la::sum(t3) == 240 && la::mean(t3) == 4 && la::max(t3) == 14 && la::min(t3) == -6);
+
+    // wide enough for packets and a tail on every axis
+    static la::Tensor<19, 33, 7> wide;
+    for (int z = 0; z < 7; z++)
+        for (int y = 0; y < 33; y++)
+            for (int x = 0; x < 19; x++)
+                wide[z][y][x] = float((x * 5 + y * 3 + z * 11) % 17) - 8;
+    la::Tensor<19, 7> wideSum = la::sum<1>(wide);
+    la::Tensor<19, 7> wideNorm = la::norm<1>(wide);
+    la::Tensor<33, 7> wideMax = la::max<0>(wide);
+    la::Tensor<19, 33> wideMin = la::min<2>(wide);
+    for (int z = 0; z < 7; z++)
+        for (int x = 0; x < 19; x++) {
+            float expected = 0, squares = 0;
+            for (int y = 0; y < 33; y++) {
+                expected += wide[z][y][x];
+                squares += wide[z][y][x] * wide[z][y][x];
+            }
+            assert(wideSum[z][x] == expected);
+            assert(std::abs(wideNorm[z][x] - std::sqrt(squares)) < 1e-4f);
+        }
+    for (int z = 0; z < 7; z++)
+        for (int y = 0; y < 33; y++) {
+            float expected = wide[z][y][0];
+            for (int x = 1; x < 19; x++)
+                expected = std::max(expected, wide[z][y][x]);
+            assert(wideMax[z][y] == expected);
+        }
+    for (int y = 0; y < 33; y++)
+        for (int x = 0; x < 19; x++) {
+            float expected = wide[0][y][x];
+            for (int z = 1; z < 7; z++)
+                expected = std::min(expected, wide[z][y][x]);
+            assert(wideMin[y][x] == expected);
+        }
+
+    // a naive float loop drifts by several percent, pairwise and Kahan sums stay exact to rounding
+    static la::Tensor<1 << 20> tenths;
+    static la::Tensor<4, 1 << 18> tenthColumns;
+    for (int i = 0; i < 1 << 20; i++) {
+        tenths[i] = 0.1f;
+        tenthColumns[i >> 2][i & 3] = 0.1f;
+    }
+    double exactTenths = double(0.1f) * (1 << 20);
+    assert(std::abs(la::sum(tenths) - exactTenths) < 1e-5 * exactTenths);
+    assert(std::abs(la::sum<0>(tenths) - exactTenths) < 1e-5 * exactTenths);
+    la::Tensor<4> columnSums = la::sum<1>(tenthColumns);
+    for (int x = 0; x < 4; x++)
+        assert(std::abs(columnSums[x] - exactTenths / 4) < 1e-5 * exactTenths / 4);
+
+    la::TensorOf<std::int8_t, 16, 8> byteGrid(100);
+    la::TensorOf<int, 8> byteColumns = la::sum<0>(byteGrid);
+    la::TensorOf<int, 16> byteRows = la::sum<1>(byteGrid);
+    la::TensorOf<int, 8> byteNorms = la::norm<0>(byteGrid);
+    assert(la::sum(byteGrid) == 12800 && la::mean(byteGrid) == 100 && la::norm(byteGrid) == 1131);
+    assert(byteColumns[7] == 1600 && byteRows[15] == 800 && byteNorms[0] == 400 && la::mean<1>(byteGrid)[3] == 100);
+    la::TensorOf<la::Half, 16, 8> halfGrid(1000.0f);
+    la::TensorOf<float, 8> halfColumns = la::sum<0>(halfGrid);
+    assert(la::sum(halfGrid) == 128000 && halfColumns[2] == 16000 && la::norm(halfGrid) > 11313);
+
+    static la::Matrix<37, 41> big1;
+    static la::Matrix<41, 29> big2;
+    static la::Matrix<37, 29> bigRef;
+    for (int i = 0; i < 37; i++)
+        for (int j = 0; j < 41; j++)
+            big1[i][j] = float((i * 7 + j * 3) % 11) - 5;
+    for (int i = 0; i < 41; i++)
+        for (int j = 0; j < 29; j++)
+            big2[i][j] = float((i * 5 + j * 2) % 13) - 6;
+    la::Kernels::gemmNaive<37, 41, 29>(&big1[0][0], &big2[0][0], &bigRef[0][0]);
+    la::Matrix<37, 29> bigProd = big1 * big2;
+    for (int i = 0; i < 37; i++)
+        for (int j = 0; j < 29; j++)
+            assert(bigProd[i][j] == bigRef[i][j]);
+
+    la::Mat3 s = {{2, -1, 0}, {-1, 2, -1}, {0, -1, 2}};
+    assert(std::abs(s.determinant() - 4) < 1e-5f);
+
+    la::Mat3 sInv = s.inverse();
+    la::Mat3 sId = s * sInv;
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            assert(std::abs(sId[i][j] - (i == j ? 1.0f : 0.0f)) < 1e-5f);
+
+    la::LU<3> sLu = s.lu();
+    la::Vector<3> x = sLu.solve({1, 0, 1});
+    la::Vector<3> sx = s * x;
+    assert(std::abs(sx[0] - 1) < 1e-5f && std::abs(sx[1]) < 1e-5f && std::abs(sx[2] - 1) < 1e-5f);
+
+    la::Mat3 sAdj = s.adjoint();
+    assert(std::abs(sAdj[0][0] - 3) < 1e-5f && std::abs(sAdj[0][2] - 1) < 1e-5f);
+
+    la::Mat2 singular = {{1, 2}, {2, 4}};
+    assert(singular.determinant() == 0);
+    la::Mat2 singularAdj = singular.adjoint();
+    assert(singularAdj[0][0] == 4 && singularAdj[0][1] == -2);
+
+    // closed-form 2x2 to 4x4 inverses agree with the LU factorization
+    la::Mat4 general = {{4, 1, -2, 3}, {0.5f, 3, 1, -1}, {2, -1, 5, 0}, {1, 2, 0, 6}};
+    la::Mat4 generalInv = general.inverse();
+    la::Mat4 generalLuInv = general.lu().inverse();
+    la::Mat4 generalAdj = general.adjoint();
+    float generalDet = general.determinant();
+    assert(std::abs(generalDet - general.lu().determinant()) < 1e-3f);
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 4; j++) {
+            assert(std::abs(generalInv[i][j] - generalLuInv[i][j]) < 1e-5f);
+            assert(std::abs(generalAdj[i][j] - generalLuInv[i][j] * generalDet) < 1e-3f);
+        }
+    la::Matrix<4, 4, double> generalD;
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 4; j++)
+            generalD[i][j] = general[i][j];
+    la::Matrix<4, 4, double> generalDInv = generalD.inverse();
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 4; j++)
+            assert(std::abs(generalDInv[i][j] - generalLuInv[i][j]) < 1e-5);
+    la::Mat2 two = {{3, 1}, {4, 2}};
+    la::Mat2 twoInv = two.inverse();
+    assert(two.determinant() == 2 && twoInv[0][0] == 1 && twoInv[0][1] == -0.5f && twoInv[1][0] == -2);
+    la::Mat4 singular4 = {{1, 2, 3, 4}, {2, 4, 6, 8}, {0, 1, 0, 1}, {1, 0, 1, 0}};
+    assert(singular4.determinant() == 0);
+    bool threw = false;
+    try {
+        (void)singular4.inverse();
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert(threw);
+
+    // rotation by 90 degrees about z then a translation
+    la::Mat4 rigid = {{0, -1, 0, 1}, {1, 0, 0, 2}, {0, 0, 1, 3}, {0, 0, 0, 1}};
+    la::Mat4 rigidInv = rigid.rigidInverse();
+    la::Mat4 rigidInvRef = rigid.inverse();
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 4; j++)
+            assert(std::abs(rigidInv[i][j] - rigidInvRef[i][j]) < 1e-6f);
+
+    // quarter turn about z, then a quarter turn about x
+    const float quarter = std::acos(0.0f);
+    la::Quat qz = la::Quat::axisAngle({0, 0, 1}, quarter);
+    la::Quat qx = la::Quat::axisAngle({1, 0, 0}, quarter);
+    la::Vec3 ex = qz.rotate({1, 0, 0});
+    assert(std::abs(ex[0]) < 1e-6f && std::abs(ex[1] - 1) < 1e-6f && std::abs(ex[2]) < 1e-6f);
+    la::Quat qxz = qx * qz;
+    la::Mat3 mxz = qx.toMat3() * qz.toMat3();
+    la::Vec3 probe = {0.3f, -1.2f, 2.5f};
+    la::Vec3 byQuat = qxz.rotate(probe);
+    la::Vector<3> byMatrix = mxz * probe;
+    la::Quat back = la::Quat::fromMatrix(mxz);
+    for (int i = 0; i < 3; i++)
+        assert(std::abs(byQuat[i] - byMatrix[i]) < 1e-5f);
+    for (int i = 0; i < 4; i++)
+        assert(std::abs(std::abs(back[i]) - std::abs(qxz[i])) < 1e-6f);
+    assert(std::abs((back * qxz.inverse())[3]) > 1 - 1e-6f);
+    la::Quat halfTurn = la::Quat::identity().slerp(qz, 0.5f);
+    la::Quat halfTurnRef = la::Quat::axisAngle({0, 0, 1}, quarter / 2);
+    la::Quat halfTurnLinear = la::Quat::identity().nlerp(qz, 0.5f);
+    for (int i = 0; i < 4; i++)
+        assert(std::abs(halfTurn[i] - halfTurnRef[i]) < 1e-6f && std::abs(halfTurnLinear[i] - halfTurnRef[i]) < 1e-6f);
+    la::Mat4 qzMatrix = qz.toMat4();
+    assert(std::abs(qzMatrix[1][0] - 1) < 1e-6f && qzMatrix[3][3] == 1 && qzMatrix[0][3] == 0);
+
+    std::vector<la::Quat> skin(37);
+    std::vector<la::Vec3> skinIn(37), skinOut(37), skinOne(37);
+    for (int i = 0; i < 37; i++) {
+        skin[i] = la::Quat::axisAngle(la::Vec3{1, float(i), 2}.normalize(), 0.1f * i);
+        skinIn[i] = {float(i), 1, -float(i) / 2};
+    }
+    la::rotate(std::span<const la::Quat>(skin), std::span<const la::Vec3>(skinIn), std::span<la::Vec3>(skinOut));
+    la::rotate(qxz, std::span<const la::Vec3>(skinIn), std::span<la::Vec3>(skinOne));
+    for (int i = 0; i < 37; i++) {
+        la::Vec3 expected = skin[i].rotate(skinIn[i]);
+        la::Vec3 expectedOne = qxz.rotate(skinIn[i]);
+        for (int c = 0; c < 3; c++) {
+            assert(std::abs(skinOut[i][c] - expected[c]) < 1e-4f);
+            assert(std::abs(skinOne[i][c] - expectedOne[c]) < 1e-4f);
+        }
+    }
+    std::vector<la::Quat> composed(37), blended(37);
+    la::compose(std::span<const la::Quat>(skin), std::span<const la::Quat>(skin), std::span<la::Quat>(composed));
+    la::slerp(std::span<const la::Quat>(skin), std::span<const la::Quat>(composed), 1.0f, std::span<la::Quat>(blended));
+    for (int i = 0; i < 37; i++) {
+        la::Quat expected = la::Quat::axisAngle(la::Vec3{1, float(i), 2}.normalize(), 0.2f * i);
+        for (int c = 0; c < 4; c++)
+            assert(std::abs(composed[i][c] - expected[c]) < 1e-5f);
+        // slerp takes the near side, which may be -expected
+        assert(std::abs(blended[i].dot(expected)) > 1 - 1e-5f);
+    }
+
+    // Affine3 agrees with the Mat4 it stands for
+    la::Affine3 scaleShift(la::Mat3{{2, 0, 1}, {0, 3, 0}, {-1, 0, 1}}, la::Vec3{1, -2, 4});
+    la::Affine3 turn = la::Affine3(rigid);
+    la::Mat4 composedRef = turn.toMat4() * scaleShift.toMat4();
+    la::Affine3 composedAffine = turn * scaleShift;
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 4; j++)
+            assert(std::abs(composedAffine.toMat4()[i][j] - composedRef[i][j]) < 1e-6f);
+    la::Vec3 point = {0.5f, -1, 2};
+    la::Vec3 affineMoved = composedAffine.transformPoint(point);
+    la::Vec3 affineTurned = composedAffine.transformDirection(point);
+    la::Vector<4> movedRef = composedRef * la::Vector<4>{0.5f, -1, 2, 1};
+    la::Vector<4> turnedRef = composedRef * la::Vector<4>{0.5f, -1, 2, 0};
+    for (int i = 0; i < 3; i++)
+        assert(std::abs(affineMoved[i] - movedRef[i]) < 1e-5f && std::abs(affineTurned[i] - turnedRef[i]) < 1e-5f);
+    la::Affine3 undo = scaleShift.inverse() * scaleShift;
+    la::Affine3 undoRigid = turn.rigidInverse() * turn;
+    la::Affine3 same = la::Affine3::identity();
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 4; j++)
+            assert(std::abs(undo[i][j] - same[i][j]) < 1e-5f && std::abs(undoRigid[i][j] - same[i][j]) < 1e-6f);
+    la::Vec3 shift = scaleShift.translation();
+    la::Mat3 scaleOnly = scaleShift.linear();
+    assert(shift[2] == 4 && scaleOnly[2][0] == -1);
+    std::vector<la::Vec3> affineIn(21), affineOut(21), affineDirs(21);
+    for (int i = 0; i < 21; i++)
+        affineIn[i] = {float(i), 1 - float(i), 0.5f};
+    la::transformPoints(composedAffine, std::span<const la::Vec3>(affineIn), std::span<la::Vec3>(affineOut));
+    la::transformDirections(composedAffine, std::span<const la::Vec3>(affineIn), std::span<la::Vec3>(affineDirs));
+    for (int i = 0; i < 21; i++) {
+        la::Vec3 expected = composedAffine.transformPoint(affineIn[i]);
+        la::Vec3 expectedDir = composedAffine.transformDirection(affineIn[i]);
+        for (int c = 0; c < 3; c++)
+            assert(std::abs(affineOut[i][c] - expected[c]) < 1e-4f && std::abs(affineDirs[i][c] - expectedDir[c]) < 1e-4f);
+    }
+
+    // the same API evaluated at compile time
+    constexpr la::Vec3 cx = {1, 0, 0};
+    constexpr la::Vec3 cy = {0, 1, 0};
+    static_assert(cx.dot(cy) == 0 && cx.cross(cy)[2] == 1 && cy.cross(cx)[2] == -1);
+    static_assert(la::Vec3(cx + cy * 2.0f).sum() == 3 && la::Vec3(cx - cy).squaredLength() == 2);
+    static_assert(cx.lerp(cy, 0.5f)[1] == 0.5f && cx.extend(1)[3] == 1 && la::Vec3(cx).x() == 1);
+
+    constexpr la::Mat4 cIdentity = la::Mat4::identity();
+    static_assert(cIdentity[2][2] == 1 && cIdentity[2][1] == 0 && cIdentity.determinant() == 1);
+
+    constexpr la::Mat3 cm = {{2, 0, 1}, {1, 3, 0}, {0, 1, 4}};
+    constexpr la::Mat3 cmT = cm.transpose();
+    constexpr la::Mat3 cmInv = cm.inverse();
+    constexpr la::Mat3 cmRound = cm * cmInv;
+    static_assert(cm.determinant() == 25 && cmT[0][1] == 1 && cmT[2][0] == 1);
+    static_assert(cm.adjoint()[0][0] == 12 && cm.adjoint()[1][0] == -4);
+    static_assert(cmRound[0][0] > 0.9999f && cmRound[0][0] < 1.0001f && cmRound[1][0] > -1e-6f && cmRound[1][0] < 1e-6f);
+    static_assert((cm * la::Vector<3>{1, 1, 1})[2] == 5);
+
+    constexpr la::Mat4 cRigid = {{0, -1, 0, 1}, {1, 0, 0, 2}, {0, 0, 1, 3}, {0, 0, 0, 1}};
+    constexpr la::Mat4 cRigidInv = cRigid.inverse();
+    static_assert(cRigidInv[0][3] == -2 && cRigidInv[1][3] == 1 && cRigidInv[2][3] == -3);
+    static_assert(cRigid.rigidInverse()[0][3] == -2 && cRigid.determinant() == 1);
+
+    constexpr la::Matrix<5, 5> cBig = la::Matrix<5, 5>::identity() * 2.0f;
+    static_assert(cBig.determinant() == 32 && cBig.inverse()[4][4] == 0.5f && cBig.solve(la::Vector<5>(4))[3] == 2);
+
+    // the runtime paths agree with the compile time ones
+    la::Mat3 rm = cm;
+    la::Mat3 rmInv = rm.inverse();
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            assert(std::abs(rmInv[i][j] - cmInv[i][j]) < 1e-6f && rm.transpose()[i][j] == cmT[i][j]);
+
+    // every tensor is one flat buffer, padded to cache lines from one cache line up
+    static_assert(sizeof(la::Tensor<3, 5, 7>) == 7 * 64 && alignof(la::Tensor<3, 5, 7>) == 64 && alignof(la::Tensor<8, 3>) == 64);
+    static_assert(alignof(la::Tensor<2, 4>) == 32 && alignof(la::Vec4) == 16 && sizeof(la::Mat3) == 9 * sizeof(float));
+    static_assert(la::Tensor<3, 5, 7>::count == 105 && cIdentity.span().size() == 16 && cIdentity.data()[0] == 1);
+
+    la::Tensor<3, 5, 7> flatA, flatB;
+    for (std::size_t i = 0; i < flatA.count; i++) {
+        flatA.data()[i] = float(i);
+        flatB.span()[i] = 2.0f * i;
+    }
+    assert(flatA[6][4][2] == 2 + 3 * 4 + 15 * 6 && reinterpret_cast<std::uintptr_t>(flatA.data()) % alignof(la::Tensor<3, 5, 7>) == 0);
+    la::Tensor<3, 5, 7> flatSum = flatA * 3.0f - flatB + 1.0f;
+    la::Tensor<3, 5, 7> flatMixed = flatA.permute(0, 0 + 1).permute(0, 1) + flatB;
+    for (std::size_t i = 0; i < flatA.count; i++)
+        assert(flatSum.data()[i] == float(i) + 1 && flatMixed.data()[i] == 3.0f * i);
+    la::Tensor<3, 5, 7> flatParallel;
+    la::assign(la::par, flatParallel, flatA + flatB);
+    assert(std::memcmp(flatParallel.data(), (flatA * 3.0f).eval().data(), flatParallel.count * sizeof(float)) == 0);
+    // rows are views into the buffer and write through to it
+    la::Mat3 rows = 0;
+    rows[1] = {1, 2, 3};
+    rows[2] = rows[1] * 2.0f;
+    rows[0] += rows[2];
+    la::Vector<3> row = rows[2];
+    assert(rows.data()[8] == 6 && rows[0][2] == 6 && row.dot(la::Vector<3>(1)) == 12 && rows[1][0] == 1);
+
+    // with LINALG_BLAS these go to the library, LU and Kernels::gemm stay inline
+    static_assert(la::Blas::routed<48, double> == la::Blas::ENABLED && !la::Blas::routed<4, float> && !la::Blas::routed<48, int>);
+    la::Matrix<48, 48, double> dense;
+    la::Matrix<48, 40, double> denseRhs;
+    la::Vector<48, double> denseB;
+    for (int i = 0; i < 48; i++) {
+        for (int j = 0; j < 48; j++) {
+            dense[i][j] = (i == j ? 60.0 : 0.0) + std::sin(1.0 + i * 7 + j * 3);
+        }
+        for (int j = 0; j < 40; j++) {
+            denseRhs[i][j] = std::cos(0.5 * i - j);
+        }
+        denseB[i] = i % 5 - 2.0;
+    }
+
+    la::Matrix<48, 40, double> denseProduct = dense * denseRhs;
+    la::Matrix<48, 40, double> kernelProduct;
+    la::Kernels::gemm<48, 48, 40>(dense.data(), denseRhs.data(), kernelProduct.data());
+    la::Vector<48, double> denseAx = dense * denseB;
+    la::Vector<48, double> denseX = dense.solve(denseB);
+    la::Vector<48, double> luX = dense.lu().solve(denseB);
+    la::Matrix<48, 48, double> denseInv = dense.inverse();
+    la::Matrix<48, 48, double> luInv = dense.lu().inverse();
+    for (int i = 0; i < 48; i++) {
+        double row = 0;
+        for (int j = 0; j < 48; j++) {
+            row += dense[i][j] * denseB[j];
+            assert(std::abs(denseInv[i][j] - luInv[i][j]) < 1e-12);
+        }
+        for (int j = 0; j < 40; j++) {
+            assert(std::abs(denseProduct[i][j] - kernelProduct[i][j]) < 1e-9);
+        }
+        assert(std::abs(denseAx[i] - row) < 1e-9 && std::abs(denseX[i] - luX[i]) < 1e-12);
+    }
+    assert(std::abs(dense.determinant() / dense.lu().determinant() - 1) < 1e-10);
+
+    la::Matrix<40, 40> singularDense = 1.0f;
+    assert(singularDense.determinant() == 0);
+    try {
+        singularDense.inverse();
+        assert(false);
+    } catch (const std::runtime_error&) {}
+
+    // sparse assembly sums duplicates, CSR and CSC agree with the dense products
+    la::Matrix<6, 5> sparseDense = 0.0f;
+    la::SparseTriplets triplets(6, 5);
+    for (int k = 0; k < 40; k++) {
+        int i = (k * 7) % 6;
+        int j = (k * 3 + k / 6) % 5;
+        if ((i + 2 * j) % 3 == 0) {
+            triplets.add(i, j, 0.5f * (k % 4 + 1));
+            sparseDense[i][j] += 0.5f * (k % 4 + 1);
+        }
+    }
+    la::CsrMatrix csr(triplets);
+    la::CscMatrix csc(csr);
+    la::CsrMatrix fromDense(sparseDense);
+    assert(csr.nonZeros() == fromDense.nonZeros() && csc.nonZeros() == csr.nonZeros() && csr.nonZeros() < triplets.size());
+    assert(std::equal(csr.indices().begin(), csr.indices().end(), fromDense.indices().begin()));
+    assert(std::memcmp(csc.dense().data(), sparseDense.data(), sparseDense.count * sizeof(float)) == 0);
+    assert(csr.transpose().at(4, 5) == csr.at(5, 4) && la::CscMatrix(triplets).at(3, 1) == sparseDense[3][1]);
+
+    la::Vector<5> sparseX = {1, -2, 0.5f, 3, -1};
+    la::Matrix<5, 3> sparseB;
+    for (int i = 0; i < 15; i++) {
+        sparseB.data()[i] = float(i % 4) - 1.5f;
+    }
+    la::Vector<6> denseY = sparseDense * sparseX;
+    la::Matrix<6, 3> denseC = sparseDense * sparseB;
+    la::DynamicTensor csrY = csr * sparseX;
+    la::DynamicTensor cscY = csc * sparseX;
+    la::DynamicTensor csrC = csr * sparseB;
+    la::DynamicTensor cscC = csc * la::DynamicTensor(sparseB);
+    assert(csrY.shape() == std::vector<std::size_t>{6} && csrC.shape() == (std::vector<std::size_t>{3, 6}));
+    for (int i = 0; i < 6; i++) {
+        assert(std::abs(csrY.data()[i] - denseY[i]) < 1e-5f && std::abs(cscY.data()[i] - denseY[i]) < 1e-5f);
+        for (int j = 0; j < 3; j++) {
+            assert(std::abs(csrC.at({std::size_t(j), std::size_t(i)}) - denseC[i][j]) < 1e-5f);
+            assert(std::abs(cscC.at({std::size_t(j), std::size_t(i)}) - denseC[i][j]) < 1e-5f);
+        }
+    }
+
+    try {
+        csr * la::Vector<6>(1.0f);
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+    la::SparseTriplets longRow(2, 100);
+    for (int j = 99; j >= 0; j--) {
+        longRow.add(1, j, float(j));
+        longRow.add(1, j / 2, 1.0f);
+    }
+    la::CsrMatrix longCsr(longRow);
+    assert(longCsr.nonZeros() == 100 && longCsr.offsets()[1] == 0 && std::is_sorted(longCsr.indices().begin(), longCsr.indices().end()));
+    assert(longCsr.at(1, 0) == 2 && longCsr.at(1, 49) == 51 && longCsr.at(1, 50) == 50 && longCsr.at(0, 3) == 0);
+
+    try {
+        la::CsrMatrix(2, 2, {0, 2, 2}, {1, 0}, {1.0f, 2.0f});
+        assert(false);
+    } catch (const std::invalid_argument&) {}
+
+    // a 2D Laplacian large enough to be split over threads, rows are summed in the same order either way
+    const std::size_t side = 300;
+    la::SparseTriplets laplacianTriplets(side * side, side * side);
+    for (std::size_t y = 0; y < side; y++) {
+        for (std::size_t x = 0; x < side; x++) {
+            std::size_t i = y * side + x;
+            laplacianTriplets.add(i, i, 4);
+            if (x > 0) laplacianTriplets.add(i, i - 1, -1);
+            if (x + 1 < side) laplacianTriplets.add(i, i + 1, -1);
+            if (y > 0) laplacianTriplets.add(i, i - side, -1);
+            if (y + 1 < side) laplacianTriplets.add(i, i + side, -1);
+        }
+    }
+    la::CsrMatrix laplacian(laplacianTriplets);
+    std::vector<float> laplacianX(side * side), laplacianSeq(side * side), laplacianPar(side * side);
+    for (std::size_t i = 0; i < laplacianX.size(); i++) {
+        laplacianX[i] = float(i % 17) - 8;
+    }
+    la::multiply(la::seq, laplacian, laplacianX, laplacianSeq);
+    la::multiply(la::par, laplacian, laplacianX, laplacianPar);
+    assert(laplacian.nonZeros() == 5 * side * side - 4 * side && laplacianSeq == laplacianPar);
+    assert(laplacianSeq[side + 1] == 4 * laplacianX[side + 1] - laplacianX[side] - laplacianX[side + 2] - laplacianX[1] - laplacianX[2 * side + 1]);
+
+    // iterative solvers on a symmetric and a non symmetric shifted 2D Laplacian
+    const std::size_t solverSide = 30;
+    const std::size_t solverN = solverSide * solverSide;
+    la::SparseTriplets spdTriplets(solverN, solverN);
+    la::SparseTriplets flowTriplets(solverN, solverN);
+    for (std::size_t i = 0; i < solverN; i++) {
+        spdTriplets.add(i, i, 4.5f + (i % 5));
+        flowTriplets.add(i, i, 4.5f);
+        if (i % solverSide > 0) {
+            spdTriplets.add(i, i - 1, -1);
+            flowTriplets.add(i, i - 1, -1.4f);
+        }
+        if (i % solverSide + 1 < solverSide) {
+            spdTriplets.add(i, i + 1, -1);
+            flowTriplets.add(i, i + 1, -0.6f);
+        }
+        if (i >= solverSide) {
+            spdTriplets.add(i, i - solverSide, -1);
+            flowTriplets.add(i, i - solverSide, -1.2f);
+        }
+        if (i + solverSide < solverN) {
+            spdTriplets.add(i, i + solverSide, -1);
+            flowTriplets.add(i, i + solverSide, -0.8f);
+        }
+    }
+    la::CsrMatrix spd(spdTriplets);
+    la::CsrMatrix flow(flowTriplets);
+
+    std::vector<float> solverB(solverN), solverX(solverN, 0.0f), solverR(solverN);
+    for (std::size_t i = 0; i < solverN; i++) {
+        solverB[i] = float(i % 7) - 3;
+    }
+    auto trueResidual = [&](const la::CsrMatrix& a) {
+        la::multiply(la::seq, a, solverX, solverR);
+        float error = 0;
+        float size = 0;
+        for (std::size_t i = 0; i < solverN; i++) {
+            error += (solverB[i] - solverR[i]) * (solverB[i] - solverR[i]);
+            size += solverB[i] * solverB[i];
+        }
+        std::fill(solverX.begin(), solverX.end(), 0.0f);
+        return std::sqrt(error / size);
+    };
+
+    std::size_t monitored = 0;
+    la::ConjugateGradient cg({.monitor = [&](std::size_t, float) { monitored++; }});
+    la::SolverReport cgPlain = cg.solve(spd, solverB, solverX);
+    assert(cgPlain.converged && cgPlain.iterations == monitored && trueResidual(spd) < 2e-5f);
+    la::SolverReport cgJacobi = cg.solve(la::par, spd, solverB, solverX, la::JacobiPreconditioner(spd));
+    assert(cgJacobi.converged && cgJacobi.iterations < cgPlain.iterations && trueResidual(spd) < 2e-5f);
+    la::SolverReport cgIlu = cg.solve(spd, solverB, solverX, la::Ilu0Preconditioner(spd));
+    assert(cgIlu.converged && cgIlu.iterations < cgJacobi.iterations && trueResidual(spd) < 2e-5f);
+
+    la::Ilu0Preconditioner flowIlu(flow);
+    la::BiCgStab bicgstab;
+    la::SolverReport biPlain = bicgstab.solve(flow, solverB, solverX);
+    assert(biPlain.converged && trueResidual(flow) < 2e-5f);
+    la::SolverReport biIlu = bicgstab.solve(flow, solverB, solverX, flowIlu);
+    assert(biIlu.converged && biIlu.iterations < biPlain.iterations && trueResidual(flow) < 2e-5f);
+
+    // a restart every 8 iterations still converges, only slower
+    la::Gmres gmres({.restart = 8});
+    la::SolverReport gmresPlain = gmres.solve(flow, solverB, solverX);
+    assert(gmresPlain.converged && gmresPlain.iterations > 8 && trueResidual(flow) < 2e-5f);
+    la::SolverReport gmresIlu = gmres.solve(la::par, la::CscMatrix(flow), solverB, solverX, flowIlu);
+    assert(gmresIlu.converged && gmresIlu.iterations < gmresPlain.iterations && trueResidual(flow) < 2e-5f);
+
+    la::SolverReport capped = la::Gmres({.maxIterations = 3}).solve(flow, solverB, solverX);
+    assert(!capped.converged && capped.iterations == 3 && capped.residual > 1e-5f);
+    std::fill(solverX.begin(), solverX.end(), 0.0f);
+
+    // ILU(0) of a tridiagonal matrix has no fill in to drop, so it is exact
+    la::Matrix<12, 12> tridiagonal = 0.0f;
+    la::Vector<12> tridiagonalB;
+    for (int i = 0; i < 12; i++) {
+        tridiagonal[i][i] = 3.0f + i % 3;
+        if (i > 0) tridiagonal[i][i - 1] = -1.5f;
+        if (i < 11) tridiagonal[i][i + 1] = -0.5f;
+        tridiagonalB[i] = float(i) - 5;
+    }
+    la::Vector<12> direct = tridiagonal.solve(tridiagonalB);
+    la::Vector<12> iterative = 0.0f;
+    la::SolverReport exact = la::BiCgStab().solve(tridiagonal, tridiagonalB.span(), iterative.span(), la::Ilu0Preconditioner(tridiagonal));
+    assert(exact.converged && exact.iterations == 1);
+    for (int i = 0; i < 12; i++) {
+        assert(std::abs(iterative[i] - direct[i]) < 1e-4f);
+    }
+
+    // any callable is an operator, here the tridiagonal matrix without storing it
+    auto stencil = [](std::span<const float> x, std::span<float> y) {
+        for (std::size_t i = 0; i < x.size(); i++) {
+            y[i] = 3.0f * x[i] - (i > 0 ? x[i - 1] : 0) - (i + 1 < x.size() ? x[i + 1] : 0);
+        }
+    };
+    std::vector<float> stencilB(100, 1.0f), stencilX(100, 0.0f), stencilY(100);
+    assert(la::ConjugateGradient().solve(stencil, stencilB, stencilX).converged);
+    stencil(stencilX, stencilY);
+    assert(std::abs(stencilY[0] - 1) < 1e-4f && std::abs(stencilY[50] - 1) < 1e-4f);
+
+    la::SparseTriplets noPivot(2, 2);
+    noPivot.add(0, 1, 1);
+    noPivot.add(1, 0, 1);
+    try {
+        la::Ilu0Preconditioner bad((la::CsrMatrix(noPivot)));
+        assert(false);
+    } catch (const std::runtime_error&) {}
+
+    la::Vec3 u = {1, 2, 3};
+    la::Vec3 w = {4, 5, 6};
+    la::Vec3 mixed = u * 2 + w / 2 - 1;
+    assert(mixed[0] == 3 && mixed[1] == 5.5f && mixed[2] == 8);
+    la::Vec3 halfway = u.lerp(w, 0.5f);
+    assert(halfway[0] == 2.5f && halfway[2] == 4.5f);
+    assert((u + w).eval().dot(u) == 46);
+
+    la::Vector<3>& ref = (u += w);
+    assert(&ref == &u && u[0] == 5);
+    u = 2.0f * u - w;
+    assert(u[0] == 6 && u[2] == 12);
+
+    la::Tensor<2, 3, 2> t1 = 1;
+    la::Tensor<2, 3, 2> t2 = t1 * 3 + t1;
+    t2 /= t1 * 2;
+    assert(t2[1][2][1] == 2);
+
+    la::Mat2 scaled = la::Mat2::identity() * 3.0f;
+    assert(scaled[0][0] == 3 && scaled[0][1] == 0);
+    la::Mat2 product = {{1, 2}, {3, 4}};
+    product *= la::Mat2{{1, 2}, {3, 4}};
+    assert(product[0][0] == 7 && product[0][1] == 10 && product[1][0] == 15 && product[1][1] == 22);
+    product *= 0.5f;
+    assert(product[0][0] == 3.5f && product[1][1] == 11);
+
+    la::Vector<37> odd;
+    la::Vector<37> ones = 1;
+    for (int i = 0; i < 37; i++)
+        odd[i] = float(i);
+    assert(odd.sum() == 666 && odd.dot(ones) == 666);
+    assert(odd.squaredLength() == 16206);
+    la::Vector<37> oddSum = odd + ones * 2;
+    assert(oddSum[0] == 2 && oddSum[36] == 38);
+
+    std::vector<la::Vec3> points;
+    for (int i = 0; i < 21; i++)
+        points.push_back({float(i + 1), float(2 * i), 3});
+    la::Vec3Batch batch{std::span<const la::Vec3>(points)};
+    assert(batch.size() == 21 && batch[20][0] == 21);
+
+    std::vector<float> lengths(21);
+    batch.length(lengths);
+    la::Vec3Batch crossed;
+    batch.cross(batch, crossed);
+    batch.normalize();
+    batch.store(std::span<la::Vec3>(points));
+    for (int i = 0; i < 21; i++) {
+        la::Vec3 original = {float(i + 1), float(2 * i), 3};
+        assert(std::abs(lengths[i] - original.length()) < 1e-4f);
+        assert(std::abs(points[i].length() - 1) < 1e-5f);
+        assert(crossed[i].squaredLength() == 0);
+    }
+    bool batchThrew = false;
+    try {
+        batch.length(std::span<float>(lengths).first(20));
+    } catch (const std::invalid_argument&) {
+        batchThrew = true;
+    }
+    assert(batchThrew);
+    batchThrew = false;
+    try {
+        batch.lerp(la::Vec3Batch(20), 0.5f, crossed);
+    } catch (const std::invalid_argument&) {
+        batchThrew = true;
+    }
+    assert(batchThrew);
+
+    la::Mat4 xf = {{0, -1, 0, 1}, {1, 0, 0, 2}, {0, 0, 1, 3}, {0, 0, 0, 1}};
+    std::vector<la::Vec3> cloud(100000), moved(100000), turned(100000);
+    for (std::size_t i = 0; i < cloud.size(); i++)
+        cloud[i] = {float(i % 17), float(i % 5), float(i % 3)};
+    la::transformPoints<la::Vec3>(xf, cloud, moved);
+    la::transformDirections<la::Vec3>(xf, cloud, turned);
+    for (std::size_t i = 0; i < cloud.size(); i += 997) {
+        la::Vector<4> expected = xf * cloud[i].extend(1);
+        assert(moved[i][0] == expected[0] && moved[i][1] == expected[1] && moved[i][2] == expected[2]);
+        assert(turned[i][0] == -cloud[i][1] && turned[i][1] == cloud[i][0]);
+    }
+
+    std::vector<la::Vec4> homogeneous = {{1, 2, 3, 0}, {1, 2, 3, 1}, {4, 5, 6, 2}};
+    std::vector<la::Vec4> homogeneousOut(3);
+    la::transform<la::Vec4>(xf, homogeneous, homogeneousOut);
+    assert(homogeneousOut[0][0] == -2 && homogeneousOut[1][0] == -1 && homogeneousOut[2][2] == 12);
+
+    la::ThreadPool pool(3);
+    std::vector<int> hits(1000, 0);
+    pool.parallelFor(0, hits.size(), 10, [&](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; i++)
+            hits[i]++;
+    });
+    for (int h : hits)
+        assert(h == 1);
+    bool poolThrew = false;
+    try {
+        pool.parallelFor(0, hits.size(), 10, [&](std::size_t first, std::size_t last) {
+            if (first <= 500 && 500 < last)
+                throw std::runtime_error("chunk failed");
+            for (std::size_t i = first; i < last; i++)
+                hits[i]++;
+        });
+    } catch (const std::runtime_error&) {
+        poolThrew = true;
+    }
+    assert(poolThrew && hits[0] == 2 && hits[999] == 2 && hits[500] == 1);
+
+    static la::Tensor<64, 64, 32> large, largeOut, largeRef;
+    static la::Tensor<32, 64, 64> largeT;
+    for (int k = 0; k < 32; k++)
+        for (int j = 0; j < 64; j++)
+            for (int i = 0; i < 64; i++)
+                large[k][j][i] = (i + j + k) % 7;
+    la::assign(la::par.on(pool), largeOut, large * 2 + 1);
+    la::assign(la::seq, largeRef, large * 2 + 1);
+    assert(largeOut[31][63][63] == largeRef[31][63][63] && largeOut[5][6][7] == 2 * (18 % 7) + 1);
+    la::assign(la::par.on(pool), largeT, large.permute(0, 2));
+    assert(largeT[63][6][5] == large[5][6][63] && largeT[1][2][30] == large[30][2][1]);
+    static la::Tensor<256, 256> plane;
+    for (int j = 0; j < 256; j++)
+        for (int i = 0; i < 256; i++)
+            plane[j][i] = i + 256 * j;
+    la::assign(la::par.on(pool), plane, plane.permute(0, 1) + plane);
+    assert(plane[3][200] == 200 + 256 * 3 + 3 + 256 * 200 && plane[200][3] == plane[3][200]);
+    assert(la::sum(la::par.on(pool), large) == la::sum(la::seq, large));
+    assert(la::dot(la::par.on(pool), large, large) == la::dot(la::seq, large, large));
+
+    static la::Vector<100003> longVector, longOut;
+    longVector = 0.5f;
+    la::assign(la::par.on(pool), longOut, longVector + longVector);
+    assert(longOut[100002] == 1 && la::sum(la::par.on(pool), longOut) == 100003);
+    assert(la::dot(la::par, longVector, longOut) == 50001.5f);
+    static la::TensorOf<la::Half, 256, 256> halfPlane(1.0f);
+    static la::TensorOf<std::int8_t, 256, 256> bytePlane(100);
+    static_assert(std::is_same_v<decltype(la::sum(la::seq, halfPlane)), float>);
+    assert(la::sum(la::seq, halfPlane) == 65536 && la::sum(la::par.on(pool), halfPlane) == 65536);
+    assert(la::dot(la::seq, halfPlane, halfPlane) == 65536 && la::dot(la::par.on(pool), halfPlane, halfPlane) == 65536);
+    assert(la::sum(la::seq, bytePlane) == 6553600 && la::sum(la::par.on(pool), bytePlane) == 6553600);
+    assert(la::dot(la::seq, bytePlane, bytePlane) == 655360000 && la::dot(la::par.on(pool), bytePlane, bytePlane) == 655360000);
+
+    la::DynamicTensor big({256, 256, 256}, 1.0f);
+    assert(big.size() == 256 * 256 * 256 && big.rank() == 3);
+    assert(reinterpret_cast<std::uintptr_t>(big.data()) % 64 == 0);
+    big.at({1, 2, 3}) = 5;
+    la::Tensor<256, 256, 256>& bigFixed = big.as<256, 256, 256>();
+    assert(bigFixed[3][2][1] == 5);
+
+    la::Tensor<2, 3, 2> fixed = 2;
+    fixed[1][2][0] = 7;
+    la::DynamicTensor fixedView = la::DynamicTensor::view(fixed);
+    assert(!fixedView.owning() && fixedView.at({0, 2, 1}) == 7);
+    fixedView *= 3;
+    assert(fixed[1][2][0] == 21 && fixed[0][0][0] == 6);
+
+    {
+        la::Arena arena;
+        la::DynamicTensor lhs({1000, 3}, 2.0f, &arena);
+        la::DynamicTensor rhs(fixed, &arena);
+        la::DynamicTensor sum = lhs * 0.5f + lhs;
+        assert(sum.at({999, 2}) == 3);
+        rhs += fixedView;
+        assert(rhs.at({0, 2, 1}) == 42 && fixed[1][2][0] == 21);
+    }
+
+    la::Matrix<3, 3, double> precise = {{4, 1, 0}, {1, 3, 1}, {0, 1, 2}};
+    la::Vector<3, double> preciseX = precise.solve({1, 2, 3});
+    la::Vector<3, double> preciseB = precise * preciseX;
+    assert(std::abs(preciseB[0] - 1) < 1e-12 && std::abs(preciseB[2] - 3) < 1e-12);
+    assert(std::abs(precise.determinant() - 18) < 1e-12);
+
+    la::Half half = 1.5f;
+    assert(half.toBits() == 0x3e00 && float(half) == 1.5f);
+    assert(float(la::Half(65520.0f)) == INFINITY && float(la::Half(1e-8f)) == 0);
+    assert(la::BFloat16(1.0f + 1.0f / 256).toBits() == 0x3f80);
+    assert(std::isnan(float(la::BFloat16(NAN))));
+
+    la::TensorOf<la::Half, 4, 2> halves(0.5f);
+    la::TensorOf<la::Half, 4, 2> halfSum = halves + halves * 2.0f;
+    assert(float(halfSum[1][3]) == 1.5f);
+    static_assert(sizeof(halfSum) == 16);
+
+    la::Vector<4, std::int8_t> bytes = {1, -2, 3, -4};
+    la::Vector<4, std::int32_t> ints = {100000, 2, 3, 4};
+    la::Vector<4, std::int32_t> doubled = ints * 2;
+    assert(bytes.dot(bytes) == 30 && doubled.sum() == 200018);
+    la::Vector<8, std::int8_t> hundreds = 100;
+    static_assert(std::is_same_v<decltype(hundreds.dot(hundreds)), int>);
+    assert(hundreds.dot(hundreds) == 80000 && hundreds.sum() == 800);
+    static la::TensorOf<la::Half, 64, 64> halfOnes(1.0f);
+    la::Vector<4096, la::Half> halfRow(1.0f);
+    assert(float(la::sum(halfOnes)) == 4096 && halfRow.sum() == 4096);
+    assert(bytes.string() == "(1, -2, 3, -4)");
+
+    // text formatting, dimension 0 innermost, and parsing it back
+    la::Tensor<3, 2> small = {{1, 2.5f, -3}, {0.1f, 5, 6}};
+    assert(small.string() == "((1.000000, 2.500000, -3.000000), (0.100000, 5.000000, 6.000000))");
+    assert(la::toString(small, {la::SHORTEST}) == "((1, 2.5, -3), (0.1, 5, 6))");
+    assert(la::toString(small, {2, false, ","}) == "1.00,2.50,-3.00\n0.10,5.00,6.00");
+    assert(la::toString(bytes, {la::SHORTEST, false, " "}) == "1 -2 3 -4");
+    char textBuffer[64];
+    std::to_chars_result formatted = la::format(textBuffer, textBuffer + 64, small, {la::SHORTEST});
+    assert(formatted.ec == std::errc() && std::string(textBuffer, formatted.ptr) == "((1, 2.5, -3), (0.1, 5, 6))");
+    assert(la::format(textBuffer, textBuffer + 10, small).ec == std::errc::value_too_large);
+    std::ostringstream textStream;
+    la::format(textStream, wide, {la::SHORTEST});
+    std::string wideText = textStream.str();
+    assert(wideText == la::toString(wide, {la::SHORTEST}));
+    static la::Tensor<19, 33, 7> wideParsed;
+    la::parse(wideText.data(), wideText.data() + wideText.size(), wideParsed);
+    assert(std::memcmp(wideParsed.data(), wide.data(), wide.count * sizeof(float)) == 0);
+    // shortest output parses back to the same bits
+    la::Vector<3> awkward = {0.1f, 1.0f / 3, 1e-30f};
+    la::Vector<3> awkwardBack;
+    std::string awkwardText = la::toString(awkward, {la::SHORTEST});
+    std::from_chars_result parsed = la::parse(awkwardText.data(), awkwardText.data() + awkwardText.size(), awkwardBack);
+    assert(parsed.ec == std::errc() && parsed.ptr == awkwardText.data() + awkwardText.size());
+    assert(std::memcmp(&awkward, &awkwardBack, sizeof(awkward)) == 0);
+    std::string csv = "1,2\n3,4\n5";
+    la::Matrix<3, 2> fromCsv;
+    assert(la::parse(csv.data(), csv.data() + csv.size(), fromCsv).ec == std::errc::invalid_argument);
+    csv += ",6\n";
+    assert(la::parse(csv.data(), csv.data() + csv.size(), fromCsv).ec == std::errc() && fromCsv[2][1] == 6 && fromCsv[1][0] == 3);
+    std::string hugeText = la::Vector<3, double>{1, 1e200, 2}.string();
+    assert(hugeText.size() == 1 + 8 + 2 + 207 + 2 + 8 + 1 && hugeText.compare(0, 14, "(1.000000, 999") == 0);
+    assert(hugeText.compare(hugeText.size() - 11, 11, ", 2.000000)") == 0);
+    assert(la::toString(la::Vector<1, double>{1e300}, {300}) == "(1e+300)");
+    std::string outOfRange = "300 5";
+    la::Vector<2, std::int8_t> narrowParsed;
+    assert(la::parse(outOfRange.data(), outOfRange.data() + outOfRange.size(), narrowParsed).ec == std::errc::result_out_of_range);
+    std::string halfOutOfRange = "1 70000";
+    la::Vector<2, la::Half> halfParsed;
+    assert(la::parse(halfOutOfRange.data(), halfOutOfRange.data() + halfOutOfRange.size(), halfParsed).ec == std::errc::result_out_of_range);
+
+    // tensor files round trip through a temporary directory
+    {
+        std::filesystem::path dir = std::filesystem::temp_directory_path() / "linalg_test_files";
+        std::filesystem::create_directories(dir);
+        std::string fixedPath = (dir / "fixed.ltf").string();
+        std::string halfPath = (dir / "half.ltf").string();
+        std::string streamPath = (dir / "stream.ltf").string();
+        std::string shortPath = (dir / "short.ltf").string();
+
+        la::saveTensor(fixedPath, t3);
+        la::MappedTensor mapped(fixedPath);
+        assert(mapped.dtype() == la::DType::Float32 && mapped.size() == 60);
+        assert((mapped.shape() == std::vector<std::size_t>{3, 4, 5}));
+        assert(reinterpret_cast<std::uintptr_t>(mapped.span<float>().data()) % la::CACHE_LINE == 0);
+        la::Tensor<3, 4, 5>& mappedT3 = mapped.as<float, 3, 4, 5>();
+        assert(std::memcmp(mappedT3.data(), t3.data(), t3.count * sizeof(float)) == 0);
+        assert(mapped.view().at({2, 3, 4}) == t3[4][3][2]);
+        mappedT3[0][0][0] = 100;
+        la::Tensor<3, 4, 5> loaded;
+        la::loadTensor(fixedPath, loaded);
+        assert(std::memcmp(loaded.data(), t3.data(), t3.count * sizeof(float)) == 0);
+
+        bool threw = false;
+        try {
+            (void)mapped.as<float, 4, 3, 5>();
+        } catch (const std::invalid_argument&) {
+            threw = true;
+        }
+        assert(threw);
+
+        la::saveTensor(halfPath, halves);
+        la::MappedTensor mappedHalves(halfPath);
+        assert(mappedHalves.dtype() == la::DType::Float16 && float(mappedHalves.span<la::Half>()[7]) == 0.5f);
+
+        {
+            la::TensorWriter writer(streamPath, {1000, 3});
+            std::vector<float> chunk(300);
+            for (int c = 0; c < 10; c++) {
+                for (int i = 0; i < 300; i++)
+                    chunk[i] = float(c * 300 + i);
+                writer.write(std::span<const float>(chunk));
+            }
+            assert(writer.written() == 3000);
+            writer.close();
+        }
+        la::MappedTensor streamed(streamPath);
+        la::DynamicTensor streamedView = streamed.view();
+        assert(streamedView.shape()[0] == 1000 && streamedView.at({999, 2}) == 2999 && streamedView.at({5, 1}) == 1005);
+
+        threw = false;
+        try {
+            la::TensorWriter writer(shortPath, {4, 4});
+            std::vector<float> few(5, 1.0f);
+            writer.write(std::span<const float>(few));
+            writer.close();
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        assert(threw);
+        threw = false;
+        try {
+            la::MappedTensor truncated(shortPath);
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        assert(threw);
+
+        std::filesystem::remove_all(dir);
+    }
+}